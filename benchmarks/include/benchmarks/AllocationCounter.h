@@ -0,0 +1,25 @@
+#ifndef PACMANGAME_ALLOCATIONCOUNTER_H
+#define PACMANGAME_ALLOCATIONCOUNTER_H
+
+#include <cstdint>
+
+namespace benchmarks {
+/**
+ * Heap allocation statistics of the whole process.
+ *
+ * Counted by the replaced global operator new/new[] (AllocationCounter.cpp),
+ * so every allocation made by GameLogic inside a benchmark is included.
+ * Over-aligned (align_val_t) allocations are not counted.
+ */
+struct AllocationStats {
+    uint64_t allocations;
+    uint64_t bytes;
+};
+
+/**
+ * @return Allocations made since process start (monotonic, thread-safe)
+ */
+AllocationStats getAllocationStats();
+} // namespace benchmarks
+
+#endif // PACMANGAME_ALLOCATIONCOUNTER_H
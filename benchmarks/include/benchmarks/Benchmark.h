@@ -0,0 +1,102 @@
+#ifndef PACMANGAME_BENCHMARK_H
+#define PACMANGAME_BENCHMARK_H
+
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace benchmarks {
+/**
+ * Prevents the compiler from optimizing away a value computed by a benchmark.
+ */
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * Measured operation: runs the benchmarked operation `iterations` times.
+ *
+ * The loop lives inside the operation so no call overhead is added per op.
+ */
+using Operation = std::function<void(long iterations)>;
+
+/**
+ * Registered benchmark.
+ *
+ * setup() builds the fixture (untimed, allocations not counted) and returns
+ * the operation to measure. It is called once per benchmark.
+ */
+struct Benchmark {
+    std::string name;
+    std::function<Operation()> setup;
+};
+
+/**
+ * Aggregated measurements of one benchmark over all repetitions.
+ */
+struct BenchmarkResult {
+    std::string name;
+    long iterations; // Ops per repetition (calibrated)
+    int repetitions;
+    double nsPerOpMean;
+    double nsPerOpMedian;
+    double nsPerOpMin;
+    double nsPerOpStddev;
+    double allocsPerOp;
+    double bytesPerOp;
+};
+
+/**
+ * Minimal benchmark harness for the logic library (no external dependencies).
+ *
+ * For each benchmark: build fixture, calibrate iteration count until one repetition
+ * takes at least minTime, then time `repetitions` repetitions. Heap allocations are
+ * counted through AllocationCounter.
+ */
+class BenchmarkRunner {
+private:
+    std::vector<Benchmark> benchmarks;
+    int repetitions;
+    double minTime;
+    std::string filter;
+
+    BenchmarkResult measure(const Benchmark& benchmark) const;
+
+public:
+    BenchmarkRunner();
+
+    void add(const std::string& name, std::function<Operation()> setup);
+
+    void setRepetitions(int count) { repetitions = count; }
+
+    /**
+     * Minimum wall time of one repetition in seconds (iteration count calibrated to reach it).
+     */
+    void setMinTime(double seconds) { minTime = seconds; }
+
+    /**
+     * Runs only benchmarks whose name contains the filter (empty = all).
+     */
+    void setFilter(const std::string& pattern) { filter = pattern; }
+
+    /**
+     * Runs all (filtered) benchmarks, progress is reported on std::cerr.
+     */
+    std::vector<BenchmarkResult> run() const;
+
+    static void writeJson(std::ostream& out, const std::vector<BenchmarkResult>& results);
+
+    static void writeCsv(std::ostream& out, const std::vector<BenchmarkResult>& results);
+
+    static void writeTable(std::ostream& out, const std::vector<BenchmarkResult>& results);
+};
+} // namespace benchmarks
+
+#endif // PACMANGAME_BENCHMARK_H
@@ -0,0 +1,15 @@
+#ifndef PACMANGAME_LOGICBENCHMARKS_H
+#define PACMANGAME_LOGICBENCHMARKS_H
+
+#include "benchmarks/Benchmark.h"
+
+namespace benchmarks {
+/**
+ * Registers the GameLogic hot path benchmarks (World, ghost AI, collision, observers, map loading).
+ *
+ * @param mapFile Shipped map used by World-level benchmarks
+ */
+void registerLogicBenchmarks(BenchmarkRunner& runner, const std::string& mapFile);
+} // namespace benchmarks
+
+#endif // PACMANGAME_LOGICBENCHMARKS_H
@@ -0,0 +1,49 @@
+#ifndef PACMANGAME_MAPGENERATOR_H
+#define PACMANGAME_MAPGENERATOR_H
+
+#include <string>
+
+namespace benchmarks {
+/**
+ * Generates ASCII maps (World::loadMap format) of arbitrary size for benchmarks.
+ *
+ * Layout: wall border, wall pillars on every even (col, row), coins on all other
+ * floor cells, fruits in the four corners, the shipped ghost house (R above door,
+ * B/P/O inside) in the center and PacMan below it.
+ */
+class MapGenerator {
+public:
+    /**
+     * @param width Columns (odd, >= 11)
+     * @param height Rows (odd, >= 11)
+     * @return Map text, one line per row
+     */
+    static std::string generate(int width, int height);
+
+    /**
+     * Ghost AI stress layout: generate() without PacMan (nobody gets caught, ghosts never pause)
+     * and ghostCount extra RED ghosts spread evenly over the coin cells.
+     *
+     * @param ghostCount Extra ghosts, at most one per coin cell
+     */
+    static std::string generateCrowd(int width, int height, int ghostCount);
+
+    /**
+     * Writes generated map to a file in the system temp directory.
+     *
+     * @return Path of written file
+     * @throws std::runtime_error if the file cannot be written
+     */
+    static std::string writeTemporary(int width, int height);
+
+    /**
+     * Writes map text to "pacman_bench_<name>.map" in the system temp directory.
+     *
+     * @return Path of written file
+     * @throws std::runtime_error if the file cannot be written
+     */
+    static std::string writeTemporary(const std::string& name, const std::string& text);
+};
+} // namespace benchmarks
+
+#endif // PACMANGAME_MAPGENERATOR_H
@@ -0,0 +1,151 @@
+#include "benchmarks/Benchmark.h"
+#include "benchmarks/AllocationCounter.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <numeric>
+
+namespace benchmarks {
+namespace {
+double elapsedSeconds(const Operation& operation, long iterations) {
+    auto start = std::chrono::steady_clock::now();
+    operation(iterations);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+std::string formatNumber(double value) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.3f", value);
+    return buffer;
+}
+
+// Benchmark names are plain ASCII identifiers, only quotes/backslashes need escaping
+std::string escapeJson(const std::string& text) {
+    std::string escaped;
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+} // namespace
+
+BenchmarkRunner::BenchmarkRunner() : repetitions(5), minTime(0.1) {}
+
+void BenchmarkRunner::add(const std::string& name, std::function<Operation()> setup) {
+    benchmarks.push_back({name, std::move(setup)});
+}
+
+std::vector<BenchmarkResult> BenchmarkRunner::run() const {
+    std::vector<BenchmarkResult> results;
+
+    for (const auto& benchmark : benchmarks) {
+        if (!filter.empty() && benchmark.name.find(filter) == std::string::npos) {
+            continue;
+        }
+
+        std::cerr << "running " << benchmark.name << "..." << std::endl;
+        results.push_back(measure(benchmark));
+    }
+    return results;
+}
+
+BenchmarkResult BenchmarkRunner::measure(const Benchmark& benchmark) const {
+    Operation operation = benchmark.setup();
+
+    // Calibration: grow iteration count until one repetition lasts minTime (also warms caches)
+    long iterations = 1;
+    while (true) {
+        double seconds = elapsedSeconds(operation, iterations);
+        if (seconds >= minTime || iterations >= (1L << 40)) {
+            break;
+        }
+
+        double scale = seconds > 0.0 ? minTime / seconds * 1.2 : 10.0;
+        iterations = static_cast<long>(iterations * std::min(10.0, std::max(2.0, scale)));
+    }
+
+    std::vector<double> nsPerOp;
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+
+    for (int repetition = 0; repetition < repetitions; repetition++) {
+        AllocationStats before = getAllocationStats();
+        double seconds = elapsedSeconds(operation, iterations);
+        AllocationStats after = getAllocationStats();
+
+        nsPerOp.push_back(seconds * 1e9 / iterations);
+        allocations += after.allocations - before.allocations;
+        bytes += after.bytes - before.bytes;
+    }
+
+    BenchmarkResult result;
+    result.name = benchmark.name;
+    result.iterations = iterations;
+    result.repetitions = repetitions;
+
+    double totalOps = static_cast<double>(iterations) * repetitions;
+    result.allocsPerOp = allocations / totalOps;
+    result.bytesPerOp = bytes / totalOps;
+
+    result.nsPerOpMean = std::accumulate(nsPerOp.begin(), nsPerOp.end(), 0.0) / nsPerOp.size();
+    result.nsPerOpMin = *std::min_element(nsPerOp.begin(), nsPerOp.end());
+
+    double variance = 0.0;
+    for (double value : nsPerOp) {
+        variance += (value - result.nsPerOpMean) * (value - result.nsPerOpMean);
+    }
+    result.nsPerOpStddev = std::sqrt(variance / nsPerOp.size());
+
+    std::sort(nsPerOp.begin(), nsPerOp.end());
+    size_t middle = nsPerOp.size() / 2;
+    result.nsPerOpMedian =
+        nsPerOp.size() % 2 == 1 ? nsPerOp[middle] : (nsPerOp[middle - 1] + nsPerOp[middle]) / 2.0;
+    return result;
+}
+
+void BenchmarkRunner::writeJson(std::ostream& out, const std::vector<BenchmarkResult>& results) {
+    out << "{\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchmarkResult& r = results[i];
+        out << "    {\"name\": \"" << escapeJson(r.name) << "\", \"iterations\": " << r.iterations
+            << ", \"repetitions\": " << r.repetitions << ", \"ns_per_op_mean\": " << formatNumber(r.nsPerOpMean)
+            << ", \"ns_per_op_median\": " << formatNumber(r.nsPerOpMedian)
+            << ", \"ns_per_op_min\": " << formatNumber(r.nsPerOpMin)
+            << ", \"ns_per_op_stddev\": " << formatNumber(r.nsPerOpStddev)
+            << ", \"allocs_per_op\": " << formatNumber(r.allocsPerOp)
+            << ", \"bytes_per_op\": " << formatNumber(r.bytesPerOp) << "}";
+        out << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+}
+
+void BenchmarkRunner::writeCsv(std::ostream& out, const std::vector<BenchmarkResult>& results) {
+    out << "name,iterations,repetitions,ns_per_op_mean,ns_per_op_median,ns_per_op_min,ns_per_op_stddev,"
+           "allocs_per_op,bytes_per_op\n";
+    for (const auto& r : results) {
+        out << r.name << "," << r.iterations << "," << r.repetitions << "," << formatNumber(r.nsPerOpMean) << ","
+            << formatNumber(r.nsPerOpMedian) << "," << formatNumber(r.nsPerOpMin) << ","
+            << formatNumber(r.nsPerOpStddev) << "," << formatNumber(r.allocsPerOp) << ","
+            << formatNumber(r.bytesPerOp) << "\n";
+    }
+}
+
+void BenchmarkRunner::writeTable(std::ostream& out, const std::vector<BenchmarkResult>& results) {
+    char line[256];
+    std::snprintf(line, sizeof(line), "%-48s %14s %12s %12s %12s\n", "benchmark", "ns/op (median)", "stddev",
+                  "allocs/op", "bytes/op");
+    out << line;
+
+    for (const auto& r : results) {
+        std::snprintf(line, sizeof(line), "%-48s %14.2f %12.2f %12.3f %12.1f\n", r.name.c_str(), r.nsPerOpMedian,
+                      r.nsPerOpStddev, r.allocsPerOp, r.bytesPerOp);
+        out << line;
+    }
+}
+} // namespace benchmarks
@@ -0,0 +1,566 @@
+#include "benchmarks/LogicBenchmarks.h"
+#include "benchmarks/MapGenerator.h"
+#include "logic/entities/GhostModel.h"
+#include "logic/entities/MovingEntityStore.h"
+#include "logic/entities/WallModel.h"
+#include "logic/patterns/NullFactory.h"
+#include "logic/patterns/Subject.h"
+#include "logic/utils/BoxKernel.h"
+#include "logic/utils/Random.h"
+#include "logic/utils/Stopwatch.h"
+#include "logic/world/DistanceField.h"
+#include "logic/world/HierarchicalPathfinder.h"
+#include "logic/world/IntersectionGraph.h"
+#include "logic/world/MapCache.h"
+#include "logic/world/MapData.h"
+#include "logic/world/World.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace benchmarks {
+namespace {
+const unsigned int SEED = 12345;
+
+/**
+ * World loaded with NullFactory; factory kept alive alongside the World.
+ */
+struct WorldFixture {
+    logic::NullFactory factory;
+    logic::World world;
+
+    explicit WorldFixture(const std::string& mapFile) {
+        world.setSeed(SEED);
+        world.setFactory(&factory);
+        world.loadMap(mapFile);
+        world.getScoreSubject()->attach(world.getScoreObject());
+    }
+};
+
+/**
+ * Centers of all cells without wall ('#'), i.e. every position an entity can occupy.
+ */
+std::vector<std::pair<float, float>> floorCellCenters(const logic::TileGrid& grid) {
+    std::vector<std::pair<float, float>> centers;
+    for (int row = 0; row < grid.getHeight(); row++) {
+        for (int col = 0; col < grid.getWidth(); col++) {
+            if (!(grid.getFlags(col, row) & logic::TileGrid::WALL)) {
+                centers.push_back({grid.getCellCenterX(col), grid.getCellCenterY(row)});
+            }
+        }
+    }
+    return centers;
+}
+
+/**
+ * TileGrid of a generated map (walls and doors only), for structures too large to load a full World for.
+ */
+std::shared_ptr<logic::TileGrid> generatedGrid(int width, int height) {
+    auto grid = std::make_shared<logic::TileGrid>();
+    grid->reset(width, height);
+
+    std::istringstream text(MapGenerator::generate(width, height));
+    std::string line;
+    for (int row = 0; row < height && std::getline(text, line); row++) {
+        for (int col = 0; col < width; col++) {
+            if (line[col] == '#') {
+                grid->addFlags(col, row, logic::TileGrid::WALL);
+            } else if (line[col] == 'D') {
+                grid->addFlags(col, row, logic::TileGrid::DOOR);
+            }
+        }
+    }
+
+    grid->buildDirectionMasks();
+    return grid;
+}
+
+void addWorldBenchmarks(BenchmarkRunner& runner, const std::string& mapFile) {
+    // Idle PacMan: ghosts chase, catch and respawn PacMan repeatedly (steady mix of all ghost states)
+    runner.add("World::update/shipped_map", [mapFile]() -> Operation {
+        auto fixture = std::make_shared<WorldFixture>(mapFile);
+        return [fixture](long iterations) {
+            for (long i = 0; i < iterations; i++) {
+                fixture->world.update(logic::Stopwatch::FIXED_TICK);
+            }
+        };
+    });
+
+    // Ghost AI stress: 1000 RED ghosts wandering a 189x209 maze (no PacMan)
+    runner.add("World::update/generated_189x209_1000_ghosts", []() -> Operation {
+        std::string path = MapGenerator::writeTemporary("crowd_189x209", MapGenerator::generateCrowd(189, 209, 1000));
+        auto fixture = std::make_shared<WorldFixture>(path);
+        return [fixture](long iterations) {
+            for (long i = 0; i < iterations; i++) {
+                fixture->world.update(logic::Stopwatch::FIXED_TICK);
+            }
+        };
+    });
+
+    // Snapshot buffers are reused across iterations, as by a rollback ring buffer
+    const std::pair<const char*, int> SNAPSHOT_MAPS[] = {{"shipped_map", 0}, {"generated_189x209_1000_ghosts", 1000}};
+    for (const auto& [mapName, ghostCount] : SNAPSHOT_MAPS) {
+        auto loadFixture = [mapFile, ghostCount = ghostCount]() {
+            if (ghostCount == 0) {
+                return std::make_shared<WorldFixture>(mapFile);
+            }
+            return std::make_shared<WorldFixture>(
+                MapGenerator::writeTemporary("crowd_189x209", MapGenerator::generateCrowd(189, 209, ghostCount)));
+        };
+
+        runner.add(std::string("World::snapshot/") + mapName, [loadFixture]() -> Operation {
+            auto fixture = loadFixture();
+            auto state = std::make_shared<logic::World::Snapshot>(fixture->world.snapshot());
+            return [fixture, state](long iterations) {
+                for (long i = 0; i < iterations; i++) {
+                    fixture->world.snapshot(*state);
+                    doNotOptimize(state->score.score);
+                }
+            };
+        });
+
+        runner.add(std::string("World::restore/") + mapName, [loadFixture]() -> Operation {
+            auto fixture = loadFixture();
+            auto state = std::make_shared<logic::World::Snapshot>(fixture->world.snapshot());
+            return [fixture, state](long iterations) {
+                for (long i = 0; i < iterations; i++) {
+                    fixture->world.restore(*state);
+                }
+            };
+        });
+
+        // One tick of play, then a warm restart to the post-load state (compare World::loadMap for a cold one)
+        runner.add(std::string("World::restart/") + mapName, [loadFixture]() -> Operation {
+            auto fixture = loadFixture();
+            return [fixture](long iterations) {
+                for (long i = 0; i < iterations; i++) {
+                    fixture->world.update(logic::Stopwatch::FIXED_TICK);
+                    fixture->world.restart();
+                }
+            };
+        });
+    }
+
+    runner.add("World::isDirectionValid/shipped_map", [mapFile]() -> Operation {
+        auto fixture = std::make_shared<WorldFixture>(mapFile);
+        auto positions = floorCellCenters(fixture->world.getTileGrid());
+        return [fixture, positions](long iterations) {
+            auto pacman = fixture->world.getPacMan();
+            size_t next = 0;
+            for (long i = 0; i < iterations; i += 4) {
+                pacman->setPosition(positions[next].first, positions[next].second);
+                next = next + 1 < positions.size() ? next + 1 : 0;
+
+                for (logic::Direction direction : logic::MOVE_DIRECTIONS) {
+                    doNotOptimize(fixture->world.isDirectionValid(direction));
+                }
+            }
+        };
+    });
+
+    runner.add("World::getViableDirectionMask/shipped_map", [mapFile]() -> Operation {
+        auto fixture = std::make_shared<WorldFixture>(mapFile);
+        const logic::TileGrid& grid = fixture->world.getTileGrid();
+        auto positions = floorCellCenters(grid);
+
+        auto store = std::make_shared<logic::MovingEntityStore>();
+        auto ghost = std::make_shared<logic::GhostModel>(*store, 0.0f, 0.0f, grid.getCellWidth() * 0.85f,
+                                                         grid.getCellHeight() * 0.85f, logic::GhostType::PINK, 0.0f);
+        ghost->setCellDimensions(grid.getCellWidth(), grid.getCellHeight());
+        ghost->markAsExited();
+
+        return [fixture, positions, store, ghost](long iterations) {
+            size_t next = 0;
+            for (long i = 0; i < iterations; i++) {
+                ghost->setPosition(positions[next].first, positions[next].second);
+                next = next + 1 < positions.size() ? next + 1 : 0;
+
+                doNotOptimize(fixture->world.getViableDirectionMask(*ghost));
+            }
+        };
+    });
+}
+
+void addGhostDecisionBenchmarks(BenchmarkRunner& runner) {
+    const std::pair<const char*, logic::GhostType> TYPES[] = {
+        {"RED", logic::GhostType::RED},
+        {"PINK", logic::GhostType::PINK},
+        {"BLUE", logic::GhostType::BLUE},
+        {"ORANGE", logic::GhostType::ORANGE},
+    };
+
+    for (const auto& [typeName, type] : TYPES) {
+        runner.add(std::string("GhostModel::makeDirectionDecision/") + typeName, [type = type]() -> Operation {
+            auto store = std::make_shared<logic::MovingEntityStore>();
+            auto ghost = std::make_shared<logic::GhostModel>(*store, 0.0f, 0.0f, 0.09f, 0.085f, type, 0.0f);
+            ghost->getRandom().seed(SEED, 1);
+            ghost->setCellDimensions(2.0f / 19.0f, 0.1f);
+            ghost->setDirection(logic::Direction::LEFT);
+
+            // Junction shapes: T-junctions, crossing, corridor
+            const logic::DirectionMask MASKS[] = {0x0F, 0x0D, 0x0E, 0x07, 0x0B, 0x0C, 0x03};
+            return [store, ghost, MASKS](long iterations) {
+                for (long i = 0; i < iterations; i++) {
+                    float pacmanX = -0.8f + 0.1f * static_cast<float>(i & 15);
+                    auto step = static_cast<uint16_t>(i & 7);
+                    logic::DirectionDistances distances = {static_cast<uint16_t>(10 + step), 12, 11,
+                                                           static_cast<uint16_t>(14 - step)};
+                    ghost->makeDirectionDecision(MASKS[i % 7], distances, pacmanX, 0.5f, logic::Direction::UP);
+                    doNotOptimize(ghost->getCurrentDirection());
+                }
+            };
+        });
+    }
+}
+
+void addPrimitiveBenchmarks(BenchmarkRunner& runner) {
+    runner.add("EntityModel::intersects", []() -> Operation {
+        auto a = std::make_shared<logic::WallModel>(0.0f, 0.0f, 0.1f, 0.1f);
+        auto hit = std::make_shared<logic::WallModel>(0.05f, 0.05f, 0.1f, 0.1f);
+        auto miss = std::make_shared<logic::WallModel>(0.5f, 0.5f, 0.1f, 0.1f);
+        return [a, hit, miss](long iterations) {
+            for (long i = 0; i < iterations; i++) {
+                const logic::EntityModel& other = (i & 1) ? *hit : *miss;
+                doNotOptimize(a->intersects(other));
+            }
+        };
+    });
+
+    runner.add("Random::getInt", []() -> Operation {
+        auto random = std::make_shared<logic::Random>(SEED);
+        return [random](long iterations) {
+            for (long i = 0; i < iterations; i++) {
+                doNotOptimize(random->getInt(0, 3));
+            }
+        };
+    });
+
+    runner.add("Random::getFloat", []() -> Operation {
+        auto random = std::make_shared<logic::Random>(SEED);
+        return [random](long iterations) {
+            for (long i = 0; i < iterations; i++) {
+                doNotOptimize(random->getFloat(0.0f, 1.0f));
+            }
+        };
+    });
+
+    // Typical fan-out: one view plus a few score/sound observers
+    runner.add("Subject::notify/4_observers", []() -> Operation {
+        struct CountingObserver : logic::Observer {
+            long count = 0;
+            void onNotify() override { count++; }
+        };
+
+        auto observers = std::make_shared<std::vector<CountingObserver>>(4);
+        auto subject = std::make_shared<logic::Subject>();
+        for (auto& observer : *observers) {
+            subject->attach(&observer);
+        }
+
+        return [observers, subject](long iterations) {
+            for (long i = 0; i < iterations; i++) {
+                subject->notify();
+            }
+            doNotOptimize((*observers)[0].count);
+        };
+    });
+}
+
+/**
+ * Packed boxes for intersectBoxes, one vector per column.
+ */
+struct PackedBoxes {
+    std::vector<float> xs;
+    std::vector<float> ys;
+    std::vector<float> widths;
+    std::vector<float> heights;
+
+    void add(float x, float y, float width, float height) {
+        xs.push_back(x);
+        ys.push_back(y);
+        widths.push_back(width);
+        heights.push_back(height);
+    }
+
+    logic::BoxColumns columns(size_t count) const {
+        return {xs.data(), ys.data(), widths.data(), heights.data(), count};
+    }
+};
+
+/**
+ * Ghost-sized boxes spread over the world; about one in ten overlaps a PacMan-sized box at the center.
+ */
+PackedBoxes randomBoxes(size_t count, logic::Random& random) {
+    PackedBoxes boxes;
+    for (size_t i = 0; i < count; i++) {
+        boxes.add(random.getFloat(-0.5f, 0.5f), random.getFloat(-0.5f, 0.5f), random.getFloat(0.05f, 0.1f),
+                  random.getFloat(0.05f, 0.1f));
+    }
+    return boxes;
+}
+
+/**
+ * Differential check: intersectBoxes must produce the scalar hit mask bit for bit, for every tail length
+ * and for the edge cases (touching edges, zero size, infinities, NaN).
+ *
+ * @throws std::runtime_error on the first mismatch
+ */
+void verifyBoxKernel() {
+    const float INF = std::numeric_limits<float>::infinity();
+    const float NAN_VALUE = std::numeric_limits<float>::quiet_NaN();
+
+    logic::Random random(SEED);
+    PackedBoxes boxes = randomBoxes(1000, random);
+
+    // The first query box spans [-0.25, 0.25]
+    const float EDGE_CASES[][4] = {
+        {0.5f, 0.0f, 0.5f, 0.5f},     {-0.5f, 0.0f, 0.5f, 0.5f}, {0.0f, 0.5f, 0.5f, 0.5f}, // Touching edges
+        {0.0f, -0.5f, 0.5f, 0.5f},    {0.5f, 0.5f, 0.5f, 0.5f},                             // Touching edge, corner
+        {0.5001f, 0.0f, 0.5f, 0.5f},                                                         // Just apart
+        {0.25f, 0.25f, 0.0f, 0.0f},   {0.0f, 0.0f, 0.0f, 0.0f},                             // Zero size
+        {INF, 0.0f, 0.1f, 0.1f},      {0.0f, 0.0f, INF, INF},                               // Infinities
+        {NAN_VALUE, 0.0f, 0.1f, 0.1f}, {0.0f, 0.0f, NAN_VALUE, 0.1f}};                      // NaN
+    for (size_t i = 0; i < boxes.xs.size(); i += 37) {
+        const float* edgeCase = EDGE_CASES[(i / 37) % 12];
+        boxes.xs[i] = edgeCase[0];
+        boxes.ys[i] = edgeCase[1];
+        boxes.widths[i] = edgeCase[2];
+        boxes.heights[i] = edgeCase[3];
+    }
+
+    const float QUERIES[][4] = {{0.0f, 0.0f, 0.5f, 0.5f}, {0.1f, -0.2f, 0.09f, 0.085f}, {NAN_VALUE, 0.0f, 0.5f, 0.5f}};
+    std::vector<uint64_t> expected((boxes.xs.size() + 63) / 64);
+    std::vector<uint64_t> actual(expected.size());
+
+    for (const auto& query : QUERIES) {
+        for (size_t count = 0; count <= boxes.xs.size(); count += (count < 80 ? 1 : 61)) {
+            size_t words = (count + 63) / 64;
+            logic::BoxColumns columns = boxes.columns(count);
+            size_t expectedHits =
+                logic::intersectBoxesScalar(query[0], query[1], query[2], query[3], columns, expected.data());
+            size_t actualHits = logic::intersectBoxes(query[0], query[1], query[2], query[3], columns, actual.data());
+
+            if (actualHits != expectedHits || !std::equal(actual.begin(), actual.begin() + words, expected.begin())) {
+                throw std::runtime_error(std::string("intersectBoxes (") + logic::boxKernelName() +
+                                         ") differs from intersectBoxesScalar for " + std::to_string(count) +
+                                         " boxes");
+            }
+        }
+    }
+}
+
+void addBoxKernelBenchmarks(BenchmarkRunner& runner) {
+    // Shipped map ghost count, a full hit-mask word, the 1000 ghost crowd
+    const size_t BOX_COUNTS[] = {4, 64, 1000};
+
+    for (size_t count : BOX_COUNTS) {
+        std::string suffix = "/" + std::to_string(count) + "_boxes";
+
+        runner.add(std::string("intersectBoxes/") + logic::boxKernelName() + suffix, [count]() -> Operation {
+            verifyBoxKernel();
+
+            logic::Random random(SEED);
+            auto boxes = std::make_shared<PackedBoxes>(randomBoxes(count, random));
+            auto hits = std::make_shared<std::vector<uint64_t>>((count + 63) / 64);
+            return [boxes, hits, count](long iterations) {
+                logic::BoxColumns columns = boxes->columns(count);
+                for (long i = 0; i < iterations; i++) {
+                    float x = static_cast<float>(i & 7) * 0.01f;
+                    doNotOptimize(logic::intersectBoxes(x, 0.0f, 0.09f, 0.09f, columns, hits->data()));
+                }
+            };
+        });
+
+        runner.add("intersectBoxesScalar" + suffix, [count]() -> Operation {
+            logic::Random random(SEED);
+            auto boxes = std::make_shared<PackedBoxes>(randomBoxes(count, random));
+            auto hits = std::make_shared<std::vector<uint64_t>>((count + 63) / 64);
+            return [boxes, hits, count](long iterations) {
+                logic::BoxColumns columns = boxes->columns(count);
+                for (long i = 0; i < iterations; i++) {
+                    float x = static_cast<float>(i & 7) * 0.01f;
+                    doNotOptimize(logic::intersectBoxesScalar(x, 0.0f, 0.09f, 0.09f, columns, hits->data()));
+                }
+            };
+        });
+    }
+}
+
+void addDistanceFieldBenchmarks(BenchmarkRunner& runner, const std::string& mapFile) {
+    // One BFS per PacMan cell change, sources cycle through every floor cell
+    const std::pair<std::string, int> MAPS[] = {{"shipped_map", 0}, {"generated_189x209", 189}};
+
+    for (const auto& [mapName, generatedWidth] : MAPS) {
+        runner.add("DistanceField::compute/" + mapName, [mapFile, generatedWidth = generatedWidth]() -> Operation {
+            std::string path = generatedWidth > 0 ? MapGenerator::writeTemporary(generatedWidth, 209) : mapFile;
+            auto fixture = std::make_shared<WorldFixture>(path);
+            const logic::TileGrid& grid = fixture->world.getTileGrid();
+
+            std::vector<std::pair<int, int>> sources;
+            for (const auto& [x, y] : floorCellCenters(grid)) {
+                sources.push_back({grid.columnAt(x), grid.rowAt(y)});
+            }
+            auto field = std::make_shared<logic::DistanceField>();
+
+            return [fixture, sources, field](long iterations) {
+                const logic::TileGrid& grid = fixture->world.getTileGrid();
+                for (long i = 0; i < iterations; i++) {
+                    const auto& [col, row] = sources[static_cast<size_t>(i) % sources.size()];
+                    field->compute(grid, col, row, true);
+                    doNotOptimize(field->get(0, 0));
+                }
+            };
+        });
+    }
+}
+
+void addPathfinderBenchmarks(BenchmarkRunner& runner, const std::string& mapFile) {
+    const std::pair<std::string, int> MAPS[] = {
+        {"shipped_map", 0}, {"generated_189x209", 189}, {"generated_999x999", 999}};
+
+    // Random (ghost cell, target cell) pairs: one query per ghost decision
+    for (const auto& [mapName, generatedWidth] : MAPS) {
+        std::string name = "HierarchicalPathfinder::query/" + mapName;
+        runner.add(name, [mapFile, generatedWidth = generatedWidth]() -> Operation {
+            std::shared_ptr<logic::TileGrid> grid;
+            if (generatedWidth > 0) {
+                grid = generatedGrid(generatedWidth, generatedWidth == 189 ? 209 : generatedWidth);
+            } else {
+                WorldFixture fixture(mapFile);
+                grid = std::make_shared<logic::TileGrid>(fixture.world.getTileGrid());
+            }
+
+            auto pathfinder = std::make_shared<logic::HierarchicalPathfinder>();
+            pathfinder->build(*grid, true);
+
+            std::vector<std::pair<int, int>> cells;
+            for (const auto& [x, y] : floorCellCenters(*grid)) {
+                cells.push_back({grid->columnAt(x), grid->rowAt(y)});
+            }
+
+            logic::Random random(SEED);
+            std::vector<std::pair<size_t, size_t>> queries(4096);
+            for (auto& [from, to] : queries) {
+                from = static_cast<size_t>(random.getInt(0, static_cast<int>(cells.size()) - 1));
+                to = static_cast<size_t>(random.getInt(0, static_cast<int>(cells.size()) - 1));
+            }
+
+            return [pathfinder, cells, queries](long iterations) {
+                for (long i = 0; i < iterations; i++) {
+                    const auto& [from, to] = queries[static_cast<size_t>(i) % queries.size()];
+                    doNotOptimize(pathfinder->getNeighbourDistances(cells[from].first, cells[from].second,
+                                                                    cells[to].first, cells[to].second));
+                }
+            };
+        });
+    }
+
+    runner.add("HierarchicalPathfinder::build/generated_999x999", []() -> Operation {
+        auto grid = generatedGrid(999, 999);
+        auto pathfinder = std::make_shared<logic::HierarchicalPathfinder>();
+        return [grid, pathfinder](long iterations) {
+            for (long i = 0; i < iterations; i++) {
+                pathfinder->build(*grid, true);
+                doNotOptimize(pathfinder->getNodeCount());
+            }
+        };
+    });
+
+    runner.add("IntersectionGraph::build/generated_999x999", []() -> Operation {
+        auto grid = generatedGrid(999, 999);
+        auto graph = std::make_shared<logic::IntersectionGraph>();
+        return [grid, graph](long iterations) {
+            for (long i = 0; i < iterations; i++) {
+                graph->build(*grid, true);
+                doNotOptimize(graph->getEdgeCount());
+            }
+        };
+    });
+}
+
+void addLoadMapBenchmarks(BenchmarkRunner& runner) {
+    const std::pair<int, int> SIZES[] = {{19, 21}, {189, 209}};
+
+    for (const auto& [width, height] : SIZES) {
+        std::string name = "World::loadMap/generated_" + std::to_string(width) + "x" + std::to_string(height);
+        runner.add(name, [width = width, height = height]() -> Operation {
+            std::string path = MapGenerator::writeTemporary(width, height);
+            auto factory = std::make_shared<logic::NullFactory>();
+            auto world = std::make_shared<logic::World>();
+            world->setFactory(factory.get());
+
+            return [path, factory, world](long iterations) {
+                for (long i = 0; i < iterations; i++) {
+                    world->loadMap(path);
+                }
+            };
+        });
+
+        // Without MapCache: every load reads and parses the ASCII file again
+        runner.add(name + "_uncached", [width = width, height = height]() -> Operation {
+            std::string path = MapGenerator::writeTemporary(width, height);
+            auto factory = std::make_shared<logic::NullFactory>();
+            auto world = std::make_shared<logic::World>();
+            world->setFactory(factory.get());
+
+            return [path, factory, world](long iterations) {
+                for (long i = 0; i < iterations; i++) {
+                    logic::MapCache::getInstance().clear();
+                    world->loadMap(path);
+                }
+            };
+        });
+
+        // Compiled map, also uncached: every load maps the binary layout again
+        runner.add(name + "_compiled", [width = width, height = height]() -> Operation {
+            std::string path = MapGenerator::writeTemporary(width, height) + ".pmap";
+            logic::MapData::compile(MapGenerator::writeTemporary(width, height), path);
+            auto factory = std::make_shared<logic::NullFactory>();
+            auto world = std::make_shared<logic::World>();
+            world->setFactory(factory.get());
+
+            return [path, factory, world](long iterations) {
+                for (long i = 0; i < iterations; i++) {
+                    logic::MapCache::getInstance().clear();
+                    world->loadMap(path);
+                }
+            };
+        });
+    }
+
+    // Map file alone (no World): parsing ASCII against mapping the compiled layout
+    for (bool compiled : {false, true}) {
+        std::string name = std::string("MapData::load/generated_999x999") + (compiled ? "_compiled" : "");
+        runner.add(name, [compiled]() -> Operation {
+            std::string path = MapGenerator::writeTemporary(999, 999);
+            if (compiled) {
+                logic::MapData::compile(path, path + ".pmap");
+                path += ".pmap";
+            }
+
+            return [path](long iterations) {
+                for (long i = 0; i < iterations; i++) {
+                    doNotOptimize(logic::MapData::load(path)->getSpawnCount());
+                }
+            };
+        });
+    }
+}
+} // namespace
+
+void registerLogicBenchmarks(BenchmarkRunner& runner, const std::string& mapFile) {
+    addWorldBenchmarks(runner, mapFile);
+    addGhostDecisionBenchmarks(runner);
+    addPrimitiveBenchmarks(runner);
+    addBoxKernelBenchmarks(runner);
+    addDistanceFieldBenchmarks(runner, mapFile);
+    addPathfinderBenchmarks(runner, mapFile);
+    addLoadMapBenchmarks(runner);
+}
+} // namespace benchmarks
@@ -0,0 +1,93 @@
+#include "benchmarks/MapGenerator.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace benchmarks {
+std::string MapGenerator::generate(int width, int height) {
+    if (width < 11 || height < 11 || width % 2 == 0 || height % 2 == 0) {
+        throw std::invalid_argument("MapGenerator: width and height must be odd and >= 11");
+    }
+
+    std::vector<std::string> rows(height, std::string(width, '.'));
+
+    for (int row = 0; row < height; row++) {
+        for (int col = 0; col < width; col++) {
+            bool border = row == 0 || col == 0 || row == height - 1 || col == width - 1;
+            if (border || (row % 2 == 0 && col % 2 == 0)) {
+                rows[row][col] = '#';
+            }
+        }
+    }
+
+    rows[1][1] = 'F';
+    rows[1][width - 2] = 'F';
+    rows[height - 2][1] = 'F';
+    rows[height - 2][width - 2] = 'F';
+
+    // Ghost house copied from the shipped map, stamped around the center
+    const std::vector<std::string> GHOST_HOUSE = {
+        ".......",
+        "...R...",
+        ".##D##.",
+        ".#BPO#.",
+        ".#####.",
+        ".......",
+    };
+    int left = width / 2 - 3;
+    int top = height / 2 - 3;
+    for (size_t y = 0; y < GHOST_HOUSE.size(); y++) {
+        for (size_t x = 0; x < GHOST_HOUSE[y].size(); x++) {
+            rows[top + y][left + x] = GHOST_HOUSE[y][x];
+        }
+    }
+
+    rows[top + GHOST_HOUSE.size()][width / 2] = 'C';
+
+    std::string text;
+    for (const auto& row : rows) {
+        text += row;
+        text += '\n';
+    }
+    return text;
+}
+
+std::string MapGenerator::generateCrowd(int width, int height, int ghostCount) {
+    std::string text = generate(width, height);
+    std::replace(text.begin(), text.end(), 'C', '.');
+
+    size_t coinCells = static_cast<size_t>(std::count(text.begin(), text.end(), '.'));
+    if (ghostCount < 0 || static_cast<size_t>(ghostCount) > coinCells) {
+        throw std::invalid_argument("MapGenerator: ghost count exceeds the coin cells");
+    }
+
+    // Every stride-th coin cell becomes a RED ghost
+    size_t stride = ghostCount > 0 ? coinCells / ghostCount : 0;
+    size_t coin = 0;
+    int placed = 0;
+    for (char& cell : text) {
+        if (cell == '.' && placed < ghostCount && coin++ % stride == 0) {
+            cell = 'R';
+            placed++;
+        }
+    }
+    return text;
+}
+
+std::string MapGenerator::writeTemporary(int width, int height) {
+    return writeTemporary(std::to_string(width) + "x" + std::to_string(height), generate(width, height));
+}
+
+std::string MapGenerator::writeTemporary(const std::string& name, const std::string& text) {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / ("pacman_bench_" + name + ".map");
+
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        throw std::runtime_error("ERROR: Cannot write generated map: " + path.string());
+    }
+    file << text;
+    return path.string();
+}
+} // namespace benchmarks
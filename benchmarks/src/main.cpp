@@ -0,0 +1,90 @@
+#include "benchmarks/Benchmark.h"
+#include "benchmarks/LogicBenchmarks.h"
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+namespace {
+void printUsage() {
+    std::cout << "Usage: PacManBench [options]\n"
+                 "  --map <file>          Map for World benchmarks (default: resources/maps/map)\n"
+                 "  --repetitions <n>     Timed repetitions per benchmark (default: 5)\n"
+                 "  --min-time <seconds>  Minimum duration of one repetition (default: 0.1)\n"
+                 "  --filter <text>       Only run benchmarks whose name contains text\n"
+                 "  --format <fmt>        table | json | csv (default: table)\n"
+                 "  --output <file>       Write results to file instead of stdout\n";
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string mapFile = "resources/maps/map";
+    std::string format = "table";
+    std::string outputFile;
+    benchmarks::BenchmarkRunner runner;
+
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+
+            if (arg == "--help" || arg == "-h") {
+                printUsage();
+                return 0;
+            }
+
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("missing value for " + arg);
+            }
+            std::string value = argv[++i];
+
+            if (arg == "--map") {
+                mapFile = value;
+            } else if (arg == "--repetitions") {
+                runner.setRepetitions(std::max(1, std::stoi(value)));
+            } else if (arg == "--min-time") {
+                runner.setMinTime(std::stod(value));
+            } else if (arg == "--filter") {
+                runner.setFilter(value);
+            } else if (arg == "--format" && (value == "table" || value == "json" || value == "csv")) {
+                format = value;
+            } else if (arg == "--output") {
+                outputFile = value;
+            } else {
+                throw std::invalid_argument("unknown option " + arg + " " + value);
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "ERROR: Invalid arguments (" << e.what() << ")" << std::endl;
+        printUsage();
+        return 2;
+    }
+
+    std::vector<benchmarks::BenchmarkResult> results;
+    try {
+        benchmarks::registerLogicBenchmarks(runner, mapFile);
+        results = runner.run();
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    std::ofstream file;
+    if (!outputFile.empty()) {
+        file.open(outputFile);
+        if (!file.is_open()) {
+            std::cerr << "ERROR: Cannot write results to " << outputFile << std::endl;
+            return 1;
+        }
+    }
+    std::ostream& out = outputFile.empty() ? std::cout : file;
+
+    if (format == "json") {
+        benchmarks::BenchmarkRunner::writeJson(out, results);
+    } else if (format == "csv") {
+        benchmarks::BenchmarkRunner::writeCsv(out, results);
+    } else {
+        benchmarks::BenchmarkRunner::writeTable(out, results);
+    }
+    return 0;
+}
@@ -1,25 +1,35 @@
 #ifndef PACMANGAME_COINMODEL_H
 #define PACMANGAME_COINMODEL_H
 
-#include "EntityModel.h"
+#include "StaticEntityModel.h"
+#include "logic/utils/BitSet.h"
 
 namespace logic {
 /**
  * Represents a collectible coin in the game world.
  *
  * Coins are static entities that can be collected by PacMan.
- * Tracking collection state enables respawning coins for next level
- * without recreating entities.
+ * Collection state lives in a World-owned BitSet, which enables respawning
+ * all coins for next level in one bulk clear without recreating entities.
  */
-class CoinModel : public EntityModel {
+class CoinModel : public StaticEntityModel {
 private:
-    bool collected;
+    BitSet* collectionState;
+    size_t collectionIndex;
 
 public:
     CoinModel(float x, float y, float width, float height);
 
     void update(float deltaTime) override;
 
+    /**
+     * Binds collection state to bit collectionIndex of a World-owned BitSet.
+     *
+     * Keeping the flags in one dense bitset lets World count and reset all
+     * coins in bulk. Unbound coins always report not collected.
+     */
+    void bindCollectionState(BitSet* state, size_t index);
+
     bool isCollected() const;
 
     void collect();
@@ -1,7 +1,7 @@
 #ifndef PACMANGAME_DOORMODEL_H
 #define PACMANGAME_DOORMODEL_H
 
-#include "EntityModel.h"
+#include "StaticEntityModel.h"
 
 namespace logic {
 /**
@@ -11,7 +11,7 @@ namespace logic {
  * Ghosts can pass through when exiting spawn or returning after being eaten.
  * Collision handling is managed by World based on ghost state.
  */
-class DoorModel : public EntityModel {
+class DoorModel : public StaticEntityModel {
 public:
     DoorModel(float x, float y, float width, float height);
 
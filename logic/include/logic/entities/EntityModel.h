@@ -2,6 +2,8 @@
 #define PACMANGAME_ENTITYMODEL_H
 
 #include "logic/patterns/Subject.h"
+#include <array>
+#include <cstdint>
 
 namespace logic {
 
@@ -10,6 +12,65 @@ namespace logic {
  */
 enum class Direction { NONE, LEFT, RIGHT, UP, DOWN };
 
+/**
+ * Set of movement directions packed in 4 bits (see directionBit()).
+ * Used for precomputed per-cell movement options.
+ */
+using DirectionMask = uint8_t;
+
+/**
+ * Movement directions in the order ghost AI evaluates them (also the mask bit order).
+ */
+inline constexpr Direction MOVE_DIRECTIONS[4] = {Direction::UP, Direction::DOWN, Direction::LEFT, Direction::RIGHT};
+
+inline constexpr DirectionMask ALL_DIRECTIONS_MASK = 0x0F;
+
+/**
+ * Path distance (in cells) per neighbour of a cell, indexed like MOVE_DIRECTIONS (see DistanceField).
+ */
+using DirectionDistances = std::array<uint16_t, 4>;
+
+inline constexpr DirectionMask directionBit(Direction dir) {
+    switch (dir) {
+    case Direction::UP:
+        return 1 << 0;
+    case Direction::DOWN:
+        return 1 << 1;
+    case Direction::LEFT:
+        return 1 << 2;
+    case Direction::RIGHT:
+        return 1 << 3;
+    case Direction::NONE:
+        return 0;
+    }
+    return 0;
+}
+
+inline constexpr int directionCount(DirectionMask mask) {
+    return ((mask >> 0) & 1) + ((mask >> 1) & 1) + ((mask >> 2) & 1) + ((mask >> 3) & 1);
+}
+
+/**
+ * AABB overlap test on center/size boxes (touching edges count as overlap).
+ * Shared by EntityModel::intersects and intersectBoxes (batched passes) so both decide identically.
+ */
+inline bool boxesIntersect(float x1, float y1, float width1, float height1, float x2, float y2, float width2,
+                           float height2) {
+    // Bounding box edges (center - half size)
+    float left1 = x1 - width1 / 2.0f;
+    float right1 = x1 + width1 / 2.0f;
+    float top1 = y1 - height1 / 2.0f;
+    float bottom1 = y1 + height1 / 2.0f;
+
+    float left2 = x2 - width2 / 2.0f;
+    float right2 = x2 + width2 / 2.0f;
+    float top2 = y2 - height2 / 2.0f;
+    float bottom2 = y2 + height2 / 2.0f;
+
+    // Boxes intersect if NOT separated on any axis
+    return !(right1 < left2 || left1 > right2 || bottom1 < top2 || top1 > bottom2);
+}
+
 /**
  * Base class for all game entities (PacMan, ghosts, walls, coins, etc.).
  *
@@ -19,31 +80,25 @@ enum class Direction { NONE, LEFT, RIGHT, UP, DOWN };
  * - Observer pattern integration (inherits from Subject)
  * - Type identification via virtual is*() methods
  *
+ * Geometry storage is up to the subclass:
+ * - StaticEntityModel: fields in the object (walls, coins, doors, ...)
+ * - MovingEntityModel: handle into World's MovingEntityStore (PacMan, ghosts)
+ *
  * All entities notify their observers on state changes for rendering.
  */
 class EntityModel : public Subject {
-protected:
-    float x;
-    float y;
-    float width;
-    float height;
-
 public:
-    EntityModel(float x, float y, float width, float height);
-
     virtual ~EntityModel();
 
     virtual void update(float deltaTime) = 0;
 
-    float getX() const;
-
-    float getY() const;
+    virtual float getX() const = 0;
 
-    float getWidth() const;
+    virtual float getY() const = 0;
 
-    float getHeight() const;
+    virtual float getWidth() const = 0;
 
-    void setPosition(float newX, float newY);
+    virtual float getHeight() const = 0;
 
     /**
      * Axis-Aligned Bounding Box (AABB) collision detection.
@@ -1,7 +1,8 @@
 #ifndef PACMANGAME_FRUITMODEL_H
 #define PACMANGAME_FRUITMODEL_H
 
-#include "EntityModel.h"
+#include "StaticEntityModel.h"
+#include "logic/utils/BitSet.h"
 
 namespace logic {
 /**
@@ -11,15 +12,21 @@ namespace logic {
  * making them vulnerable and reversing their direction.
  * Respawns for next level like coins.
  */
-class FruitModel : public EntityModel {
+class FruitModel : public StaticEntityModel {
 private:
-    bool collected;
+    BitSet* collectionState;
+    size_t collectionIndex;
 
 public:
     FruitModel(float x, float y, float width, float height);
 
     void update(float deltaTime) override;
 
+    /**
+     * Binds collection state to a bit of World's fruit BitSet (same scheme as CoinModel).
+     */
+    void bindCollectionState(BitSet* state, size_t index);
+
     bool isCollected() const;
     void collect();
 
@@ -1,8 +1,8 @@
 #ifndef PACMANGAME_GHOSTMODEL_H
 #define PACMANGAME_GHOSTMODEL_H
 
-#include "EntityModel.h"
-#include <vector>
+#include "MovingEntityModel.h"
+#include "logic/utils/Random.h"
 
 namespace logic {
 /**
@@ -33,19 +33,18 @@ enum class GhostState { SPAWNING, CHASING, FEAR, EATEN, RESPAWNING, EXITING_SPAW
  * - Fear mode: flees from PacMan, reduced speed
  * - Eaten state: eyes return to spawn, then respawn with flicker effect
  * - Hardcoded exit routes from spawn area per ghost type
+ *
+ * Position, size, speed, current direction and state live in the MovingEntityStore slot;
+ * the object keeps the colder per-ghost state (timers, spawn data, random stream).
  */
-class GhostModel : public EntityModel {
+class GhostModel : public MovingEntityModel {
 private:
     GhostType type;
-    GhostState state;
     float spawnDelay;
     float spawnTimer;
-    float speed;
 
     float targetSpeed;
 
-    Direction currentDirection;
-
     float cellWidth;
     float cellHeight;
 
@@ -54,25 +53,35 @@ private:
     float eatenRespawnX;
     float eatenRespawnY;
 
-    int exitStepCounter;
+    float exitTimer; // Time on the current exit route leg
 
     float fearTimer;
 
     float respawnFlickerTimer;
     int respawnFlickerCount;
 
+    int decisionNode; // Intersection graph node of the last AI decision, -1 once the ghost left it
+
+    Random random; // Own stream, seeded by World (RED decisions, random viable direction)
+
+    void setState(GhostState state) { store->setState(slot, static_cast<uint8_t>(state)); }
+
     Direction getReverseDirection(Direction dir) const;
 
+    /**
+     * Option with the smallest (or, when fleeing, largest) reachable path distance.
+     * Ties keep the current direction. NONE if no option is reachable.
+     */
+    Direction chooseByPathDistance(DirectionMask options, const DirectionDistances& distances, bool flee) const;
+
 public:
-    GhostModel(float x, float y, float width, float height, GhostType type, float spawnDelay);
+    GhostModel(MovingEntityStore& store, float x, float y, float width, float height, GhostType type, float spawnDelay);
 
     void update(float deltaTime) override;
 
     GhostType getType() const { return type; }
 
-    GhostState getState() const { return state; }
-
-    Direction getCurrentDirection() const { return currentDirection; }
+    GhostState getState() const { return static_cast<GhostState>(store->getState(slot)); }
 
     bool hasExited() const { return hasExitedSpawn; }
 
@@ -80,6 +89,12 @@ public:
 
     void setCellDimensions(float cellW, float cellH);
 
+    Random& getRandom() { return random; }
+
+    int getDecisionNode() const { return decisionNode; }
+
+    void setDecisionNode(int node) { decisionNode = node; }
+
     void setDirection(Direction dir);
 
     void stopMovement();
@@ -91,10 +106,10 @@ public:
      * - Multiple viable directions available (intersection)
      * - Current direction no longer viable (forced turn)
      *
-     * @param viableDirections Directions that don't collide with walls
+     * @param viableDirections Mask of directions that don't collide with walls
      * @return true if new direction decision needed
      */
-    bool needsDirectionDecision(const std::vector<Direction>& viableDirections) const;
+    bool needsDirectionDecision(DirectionMask viableDirections) const;
 
     /**
      * Determines next direction based on ghost type AI.
@@ -102,17 +117,22 @@ public:
      * Filters out backwards direction (no 180° turns).
      * AI behavior per type:
      * - RED: 50% keep direction, 50% random viable
-     * - PINK/BLUE: Minimize distance to 4 tiles ahead of PacMan
-     * - ORANGE: Minimize distance to PacMan's current position
-     * - FEAR mode: Maximize distance from PacMan (flee behavior)
+     * - PINK/BLUE: Minimize maze path distance to 4 tiles ahead of PacMan
+     * - ORANGE: Minimize maze path distance to PacMan
+     * - FEAR mode: Maximize maze path distance from PacMan (flee behavior)
      *
-     * @param viableDirections Directions that don't collide
+     * Path distances come from World (distance field around PacMan, pathfinder queries for the
+     * PINK/BLUE prediction); when the target is unreachable from every option, the ghost falls
+     * back to Manhattan distance.
+     *
+     * @param viableDirections Mask of directions that don't collide
+     * @param pathDistances Path distance from each neighbour cell to the ghost's target (UNREACHABLE if none)
      * @param targetX PacMan's X position
      * @param targetY PacMan's Y position
      * @param pacmanDirection Direction PacMan is facing (for PINK/BLUE prediction)
      */
-    void makeDirectionDecision(const std::vector<Direction>& viableDirections, float targetX, float targetY,
-                               Direction pacmanDirection);
+    void makeDirectionDecision(DirectionMask viableDirections, const DirectionDistances& pathDistances,
+                               float targetX, float targetY, Direction pacmanDirection);
 
     void enterFearMode();
 
@@ -124,11 +144,11 @@ public:
 
     int getRespawnFlickerCount() const { return respawnFlickerCount; }
 
-    bool isFeared() const { return state == GhostState::FEAR; }
+    bool isFeared() const { return getState() == GhostState::FEAR; }
 
     void getEaten();
 
-    bool isEaten() const { return state == GhostState::EATEN; }
+    bool isEaten() const { return getState() == GhostState::EATEN; }
 
     void setEatenRespawnPosition(float x, float y);
 
@@ -136,6 +156,11 @@ public:
 
     float getEatenRespawnY() const { return eatenRespawnY; }
 
+    /**
+     * Ends the EATEN return: snaps to the eaten respawn position and starts respawn flickering.
+     */
+    void arriveAtSpawn();
+
     void startExitingSpawn();
 
     void resetToSpawn(float delay);
@@ -144,9 +169,37 @@ public:
 
     bool isGhost() const override { return true; }
 
-    float getSpeed() const { return speed; }
-
     float getTargetSpeed() const { return targetSpeed; }
+
+    /**
+     * Mutable simulation state including the random stream (type, size and cell dimensions are fixed by the map).
+     */
+    struct Snapshot {
+        float x;
+        float y;
+        GhostState state;
+        float spawnDelay;
+        float spawnTimer;
+        float speed;
+        float targetSpeed;
+        Direction currentDirection;
+        bool hasExitedSpawn;
+        float eatenRespawnX;
+        float eatenRespawnY;
+        float exitTimer;
+        float fearTimer;
+        float respawnFlickerTimer;
+        int respawnFlickerCount;
+        int decisionNode;
+        Random::State random;
+    };
+
+    Snapshot snapshot() const;
+
+    /**
+     * Restores state without interpolation (previous position = restored position).
+     */
+    void restore(const Snapshot& snapshot);
 };
 } // namespace logic
 
@@ -0,0 +1,78 @@
+#ifndef PACMANGAME_MOVINGENTITYMODEL_H
+#define PACMANGAME_MOVINGENTITYMODEL_H
+
+#include "EntityModel.h"
+#include "MovingEntityStore.h"
+
+namespace logic {
+/**
+ * Entity that moves every tick (PacMan, ghosts): a thin handle into a MovingEntityStore slot.
+ *
+ * Position, previous-tick position (render interpolation), size, speed and direction live in
+ * the store's arrays; subclasses keep only their colder per-entity state. The store must outlive
+ * the handle (World clears it after destroying its entities).
+ */
+class MovingEntityModel : public EntityModel {
+protected:
+    MovingEntityStore* store;
+    size_t slot;
+
+    void setCurrentDirection(Direction direction) { store->setDirection(slot, direction); }
+
+    void setCurrentSpeed(float speed) { store->setSpeed(slot, speed); }
+
+public:
+    /**
+     * Claims a new slot in store (no direction, state 0).
+     */
+    MovingEntityModel(MovingEntityStore& store, float x, float y, float width, float height, float speed);
+
+    size_t getSlot() const { return slot; }
+
+    float getX() const final { return store->getX(slot); }
+
+    float getY() const final { return store->getY(slot); }
+
+    float getWidth() const final { return store->getWidth(slot); }
+
+    float getHeight() const final { return store->getHeight(slot); }
+
+    float getSpeed() const { return store->getSpeed(slot); }
+
+    Direction getCurrentDirection() const { return store->getDirection(slot); }
+
+    void setPosition(float newX, float newY) { store->setPosition(slot, newX, newY); }
+
+    /**
+     * Moves entity without interpolation (spawns, respawns, tunnel wraparound).
+     * Previous position is set too, so views never draw the jump in between.
+     */
+    void teleport(float newX, float newY);
+
+    /**
+     * Records current position as previous-tick position (World does all slots at once at tick start).
+     */
+    void storePreviousPosition() { store->storePreviousPosition(slot); }
+
+    float getPreviousX() const { return store->getPreviousX(slot); }
+
+    float getPreviousY() const { return store->getPreviousY(slot); }
+
+    /**
+     * Position between previous and current tick.
+     *
+     * @param alpha 0 = previous tick, 1 = current tick
+     */
+    float getInterpolatedX(float alpha) const {
+        float previousX = getPreviousX();
+        return previousX + (getX() - previousX) * alpha;
+    }
+
+    float getInterpolatedY(float alpha) const {
+        float previousY = getPreviousY();
+        return previousY + (getY() - previousY) * alpha;
+    }
+};
+} // namespace logic
+
+#endif // PACMANGAME_MOVINGENTITYMODEL_H
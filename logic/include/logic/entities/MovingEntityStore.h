@@ -0,0 +1,110 @@
+#ifndef PACMANGAME_MOVINGENTITYSTORE_H
+#define PACMANGAME_MOVINGENTITYSTORE_H
+
+#include "EntityModel.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace logic {
+/**
+ * Struct-of-arrays storage for the hot state of moving entities (PacMan, ghosts).
+ *
+ * One slot per entity, one contiguous array per field: per-tick passes over many ghosts
+ * (previous-position copy, contact tests) stream through the fields they need instead of
+ * touching every ghost object. MovingEntityModel is the per-entity handle (store + slot).
+ *
+ * Slots are handed out in creation order and stay valid until clear(); World creates ghosts
+ * first, so ghost i of the loaded level occupies slot i.
+ *
+ * Columns:
+ * - x, y, previousX, previousY: center position now and at the start of the tick
+ * - width, height: bounding box size
+ * - speed: normalized units per second
+ * - direction: current movement direction
+ * - state: owner-defined state code (GhostState for ghosts, unused by PacMan)
+ */
+class MovingEntityStore {
+private:
+    std::vector<float> xs;
+    std::vector<float> ys;
+    std::vector<float> previousXs;
+    std::vector<float> previousYs;
+    std::vector<float> widths;
+    std::vector<float> heights;
+    std::vector<float> speeds;
+    std::vector<Direction> directions;
+    std::vector<uint8_t> states;
+
+public:
+    /**
+     * Appends a slot (previous position = position, no direction, state 0).
+     *
+     * @return Slot index
+     */
+    size_t add(float x, float y, float width, float height, float speed);
+
+    void reserve(size_t count);
+
+    /**
+     * Drops every slot. Handles into this store must not be used afterwards.
+     */
+    void clear();
+
+    size_t size() const { return xs.size(); }
+
+    /**
+     * Records every current position as previous-tick position (two array copies).
+     */
+    void storePreviousPositions();
+
+    float getX(size_t slot) const { return xs[slot]; }
+
+    float getY(size_t slot) const { return ys[slot]; }
+
+    float getPreviousX(size_t slot) const { return previousXs[slot]; }
+
+    float getPreviousY(size_t slot) const { return previousYs[slot]; }
+
+    float getWidth(size_t slot) const { return widths[slot]; }
+
+    float getHeight(size_t slot) const { return heights[slot]; }
+
+    float getSpeed(size_t slot) const { return speeds[slot]; }
+
+    Direction getDirection(size_t slot) const { return directions[slot]; }
+
+    uint8_t getState(size_t slot) const { return states[slot]; }
+
+    void setPosition(size_t slot, float x, float y) {
+        xs[slot] = x;
+        ys[slot] = y;
+    }
+
+    void storePreviousPosition(size_t slot) {
+        previousXs[slot] = xs[slot];
+        previousYs[slot] = ys[slot];
+    }
+
+    void setSpeed(size_t slot, float speed) { speeds[slot] = speed; }
+
+    void setDirection(size_t slot, Direction direction) { directions[slot] = direction; }
+
+    void setState(size_t slot, uint8_t state) { states[slot] = state; }
+
+    /**
+     * Column data for batched passes (size() entries each, slot order).
+     */
+    const float* getXData() const { return xs.data(); }
+
+    const float* getYData() const { return ys.data(); }
+
+    const float* getWidthData() const { return widths.data(); }
+
+    const float* getHeightData() const { return heights.data(); }
+
+    const uint8_t* getStateData() const { return states.data(); }
+};
+} // namespace logic
+
+#endif // PACMANGAME_MOVINGENTITYSTORE_H
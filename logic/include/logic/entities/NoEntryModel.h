@@ -1,7 +1,7 @@
 #ifndef PACMANGAME_NOENTRYMODEL_H
 #define PACMANGAME_NOENTRYMODEL_H
 
-#include "EntityModel.h"
+#include "StaticEntityModel.h"
 #include "GhostModel.h"
 #include <unordered_set>
 
@@ -13,7 +13,7 @@ namespace logic {
  * starting positions (BLUE can't enter ORANGE spot and vice versa).
  * Does not block PacMan or walls - only affects ghost pathfinding.
  */
-class NoEntryModel : public EntityModel {
+class NoEntryModel : public StaticEntityModel {
 private:
     std::unordered_set<GhostType> blockedGhostTypes;
 
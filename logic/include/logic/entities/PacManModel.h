@@ -1,7 +1,7 @@
 #ifndef PACMANGAME_PACMANMODEL_H
 #define PACMANGAME_PACMANMODEL_H
 
-#include "EntityModel.h"
+#include "MovingEntityModel.h"
 
 namespace logic {
 
@@ -13,13 +13,13 @@ namespace logic {
  * - Center-locking: auto-aligns to grid perpendicular to movement direction
  * - Death animation: 2-second animation before respawn
  * - Lives system: 3 lives, respawn on death until depleted
+ *
+ * Position, size, speed and current direction live in the MovingEntityStore slot.
  */
-class PacManModel : public EntityModel {
+class PacManModel : public MovingEntityModel {
 private:
-    float speed;
     int lives;
 
-    Direction currentDirection;
     Direction nextDirection;
 
     float cellWidth;
@@ -29,7 +29,7 @@ private:
     float deathTimer;
 
 public:
-    PacManModel(float x, float y, float width, float height, float speed = 0.5f);
+    PacManModel(MovingEntityStore& store, float x, float y, float width, float height, float speed = 0.5f);
 
     void update(float deltaTime) override;
 
@@ -37,10 +37,6 @@ public:
 
     void loseLife();
 
-    float getSpeed() const;
-
-    Direction getCurrentDirection() const;
-
     Direction getNextDirection() const;
 
     void setSpeed(float speed);
@@ -80,6 +76,27 @@ public:
     void respawn(float spawnX, float spawnY);
 
     bool isPacMan() const override { return true; }
+
+    /**
+     * Mutable simulation state (cell dimensions and size come from the map and are not included).
+     */
+    struct Snapshot {
+        float x;
+        float y;
+        float speed;
+        int lives;
+        Direction currentDirection;
+        Direction nextDirection;
+        bool isDying;
+        float deathTimer;
+    };
+
+    Snapshot snapshot() const;
+
+    /**
+     * Restores state without interpolation (previous position = restored position).
+     */
+    void restore(const Snapshot& snapshot);
 };
 } // namespace logic
 
@@ -0,0 +1,32 @@
+#ifndef PACMANGAME_STATICENTITYMODEL_H
+#define PACMANGAME_STATICENTITYMODEL_H
+
+#include "EntityModel.h"
+
+namespace logic {
+/**
+ * Entity that keeps its place for the whole level (walls, coins, doors, NoEntry barriers, fruits).
+ *
+ * Geometry is stored in the object itself and fixed at construction.
+ */
+class StaticEntityModel : public EntityModel {
+protected:
+    float x;
+    float y;
+    float width;
+    float height;
+
+public:
+    StaticEntityModel(float x, float y, float width, float height);
+
+    float getX() const final { return x; }
+
+    float getY() const final { return y; }
+
+    float getWidth() const final { return width; }
+
+    float getHeight() const final { return height; }
+};
+} // namespace logic
+
+#endif // PACMANGAME_STATICENTITYMODEL_H
@@ -1,14 +1,14 @@
 #ifndef PACMANGAME_WALLMODEL_H
 #define PACMANGAME_WALLMODEL_H
 
-#include "EntityModel.h"
+#include "StaticEntityModel.h"
 
 namespace logic {
 /**
  * Represents a static wall obstacle in the maze.
  * Blocks movement for both PacMan and ghosts.
  */
-class WallModel : public EntityModel {
+class WallModel : public StaticEntityModel {
 public:
     WallModel(float x, float y, float width, float height);
 
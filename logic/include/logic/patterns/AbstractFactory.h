@@ -3,7 +3,9 @@
 
 #include "logic/entities/EntityModel.h"
 #include "logic/entities/GhostModel.h"
+#include "logic/entities/MovingEntityStore.h"
 #include "logic/patterns/Observer.h"
+#include "logic/utils/LevelArena.h"
 #include <memory>
 
 namespace logic {
@@ -12,10 +14,11 @@ namespace logic {
  *
  * Pairs logic model (shared ownership) with its view observer (unique ownership).
  * Enables complete separation between logic and representation layers.
+ * Both live in the LevelArena passed to the factory method.
  */
 struct EntityCreationResult {
     std::shared_ptr<EntityModel> model;
-    std::unique_ptr<Observer> view;
+    ArenaPtr<Observer> view;
 };
 
 /**
@@ -25,25 +28,31 @@ struct EntityCreationResult {
  * SFML-specific view implementations. Concrete factory in representation
  * layer creates both model and view, attaching view as observer to model.
  *
+ * Models and views are created in the arena World passes in (LevelArena::makeShared / make),
+ * never on the heap: World frees a whole level at once in clearWorld().
+ * PacMan and ghost models claim their slot in the MovingEntityStore World passes in.
+ *
  * This enforces complete separation: logic library compiles without SFML.
  */
 class AbstractFactory {
 public:
     virtual ~AbstractFactory() = default;
 
-    virtual EntityCreationResult createWall(float x, float y, float w, float h) = 0;
+    virtual EntityCreationResult createWall(LevelArena& arena, float x, float y, float w, float h) = 0;
 
-    virtual EntityCreationResult createPacMan(float x, float y, float w, float h, float speed) = 0;
+    virtual EntityCreationResult createPacMan(LevelArena& arena, MovingEntityStore& store, float x, float y, float w,
+                                              float h, float speed) = 0;
 
-    virtual EntityCreationResult createCoin(float x, float y, float w, float h) = 0;
+    virtual EntityCreationResult createCoin(LevelArena& arena, float x, float y, float w, float h) = 0;
 
-    virtual EntityCreationResult createGhost(float x, float y, float w, float h, GhostType type, float spawnDelay) = 0;
+    virtual EntityCreationResult createGhost(LevelArena& arena, MovingEntityStore& store, float x, float y, float w,
+                                             float h, GhostType type, float spawnDelay) = 0;
 
-    virtual EntityCreationResult createDoor(float x, float y, float w, float h) = 0;
+    virtual EntityCreationResult createDoor(LevelArena& arena, float x, float y, float w, float h) = 0;
 
-    virtual EntityCreationResult createNoEntry(float x, float y, float w, float h) = 0;
+    virtual EntityCreationResult createNoEntry(LevelArena& arena, float x, float y, float w, float h) = 0;
 
-    virtual EntityCreationResult createFruit(float x, float y, float w, float h) = 0;
+    virtual EntityCreationResult createFruit(LevelArena& arena, float x, float y, float w, float h) = 0;
 };
 } // namespace logic
 
@@ -0,0 +1,34 @@
+#ifndef PACMANGAME_NULLFACTORY_H
+#define PACMANGAME_NULLFACTORY_H
+
+#include "logic/patterns/AbstractFactory.h"
+
+namespace logic {
+/**
+ * AbstractFactory that creates models only (every view is nullptr).
+ *
+ * Used for headless runs (simulation, benchmarks): World behaves exactly as in
+ * the game but nothing is observed or drawn, so no SFML window, textures or sounds are needed.
+ * A World built with this factory must not be rendered.
+ */
+class NullFactory : public AbstractFactory {
+public:
+    EntityCreationResult createWall(LevelArena& arena, float x, float y, float w, float h) override;
+
+    EntityCreationResult createPacMan(LevelArena& arena, MovingEntityStore& store, float x, float y, float w, float h,
+                                      float speed) override;
+
+    EntityCreationResult createCoin(LevelArena& arena, float x, float y, float w, float h) override;
+
+    EntityCreationResult createGhost(LevelArena& arena, MovingEntityStore& store, float x, float y, float w, float h,
+                                     GhostType type, float spawnDelay) override;
+
+    EntityCreationResult createDoor(LevelArena& arena, float x, float y, float w, float h) override;
+
+    EntityCreationResult createNoEntry(LevelArena& arena, float x, float y, float w, float h) override;
+
+    EntityCreationResult createFruit(LevelArena& arena, float x, float y, float w, float h) override;
+};
+} // namespace logic
+
+#endif // PACMANGAME_NULLFACTORY_H
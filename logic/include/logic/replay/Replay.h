@@ -0,0 +1,94 @@
+#ifndef PACMANGAME_REPLAY_H
+#define PACMANGAME_REPLAY_H
+
+#include "logic/entities/EntityModel.h"
+#include "logic/utils/Stopwatch.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace logic {
+/**
+ * Player input that influences the simulation (everything else is derived from the seed).
+ */
+enum class InputAction : uint8_t {
+    UP,
+    DOWN,
+    LEFT,
+    RIGHT,
+    FEAR_CHEAT, // "GHOST" cheat code
+    LEVEL_CHEAT // "LEVEL" cheat code
+};
+
+/**
+ * @return Arrow key action for a movement direction (UP for NONE)
+ */
+InputAction inputActionFor(Direction direction);
+
+/**
+ * Input applied before the given level tick (LevelSession::getTick()).
+ */
+struct InputEvent {
+    uint32_t tick;
+    InputAction action;
+};
+
+/**
+ * Complete level state at the start of a tick, before that tick's inputs (LevelSession::writeState).
+ */
+struct Keyframe {
+    uint32_t tick;
+    std::vector<uint8_t> state;
+};
+
+/**
+ * Recorded level session: everything needed to reproduce it exactly, seekable through keyframes.
+ *
+ * Map + seed + tick duration + timed inputs fully determine every World state;
+ * finalChecksum (World::checksum after tickCount ticks) lets playback verify it.
+ * Keyframes every keyframeInterval ticks bound the cost of seeking to one interval of re-simulation.
+ *
+ * File format (binary, little endian, varints as in ByteStream):
+ * - "PMRP", version, map path, seed, tick duration, tick count, final checksum, keyframe interval
+ * - Inputs: count, then per input varint((ticks since previous input << 3) | action),
+ *   i.e. idle stretches are run-length encoded and a typical input takes 1-2 bytes
+ * - Keyframes: count, then per keyframe varint(ticks since previous keyframe), size, state bytes
+ *
+ * An hour of play at the default interval is a few tens of kilobytes.
+ */
+struct Replay {
+    static constexpr uint32_t DEFAULT_KEYFRAME_INTERVAL = 30 * Stopwatch::TICK_RATE; // 30 s at the default tick rate
+
+    std::string mapFile;
+    uint64_t seed = 0;
+    float tickDuration = 0.0f;
+    uint32_t tickCount = 0;
+    uint64_t finalChecksum = 0;
+    uint32_t keyframeInterval = DEFAULT_KEYFRAME_INTERVAL;
+    std::vector<InputEvent> inputs;  // Ascending ticks
+    std::vector<Keyframe> keyframes; // Ascending ticks, first at tick 0
+
+    /**
+     * @return Latest keyframe at or before tick, nullptr if there is none
+     */
+    const Keyframe* findKeyframe(uint32_t tick) const;
+
+    /**
+     * @return Index of the first input at or after tick (inputs.size() if none)
+     */
+    size_t findInput(uint32_t tick) const;
+
+    /**
+     * @throws std::runtime_error if the file cannot be written
+     */
+    void save(const std::string& filename) const;
+
+    /**
+     * @throws std::runtime_error if the file is missing or malformed
+     */
+    static Replay load(const std::string& filename);
+};
+} // namespace logic
+
+#endif // PACMANGAME_REPLAY_H
@@ -0,0 +1,65 @@
+#ifndef PACMANGAME_BITSET_H
+#define PACMANGAME_BITSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace logic {
+/**
+ * Dense runtime-sized bitset (64 bits per word).
+ *
+ * Used for per-level collection state of coins and fruits:
+ * - test/set/reset are single word operations
+ * - count() is a popcount over the words (no per-element scan)
+ * - clearAll() resets every bit in one pass (level restart)
+ * - Raw word access copies the whole state in one memcpy (World snapshots)
+ */
+class BitSet {
+private:
+    std::vector<uint64_t> words;
+    size_t bitCount;
+
+public:
+    BitSet();
+
+    /**
+     * Resizes to bitCount bits, all cleared.
+     */
+    void resize(size_t bitCount);
+
+    size_t size() const { return bitCount; }
+
+    bool test(size_t index) const { return (words[index >> 6] >> (index & 63)) & 1u; }
+
+    void set(size_t index) { words[index >> 6] |= uint64_t(1) << (index & 63); }
+
+    void reset(size_t index) { words[index >> 6] &= ~(uint64_t(1) << (index & 63)); }
+
+    void clearAll();
+
+    /**
+     * @return Number of set bits
+     */
+    size_t count() const;
+
+    size_t wordCount() const { return words.size(); }
+
+    /**
+     * Backing words, bit i in words[i / 64] at position i % 64. Bits past size() are always 0.
+     */
+    const uint64_t* data() const { return words.data(); }
+
+    /**
+     * Writable backing words for bulk producers (e.g. intersectBoxes); bits past size() must stay 0.
+     */
+    uint64_t* data() { return words.data(); }
+
+    /**
+     * Overwrites all words from source (wordCount() entries).
+     */
+    void assignWords(const uint64_t* source);
+};
+} // namespace logic
+
+#endif // PACMANGAME_BITSET_H
@@ -0,0 +1,42 @@
+#ifndef PACMANGAME_BOXKERNEL_H
+#define PACMANGAME_BOXKERNEL_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace logic {
+/**
+ * Packed center/size boxes, one array per field (e.g. MovingEntityStore columns).
+ */
+struct BoxColumns {
+    const float* xs;
+    const float* ys;
+    const float* widths;
+    const float* heights;
+    size_t count;
+};
+
+/**
+ * Tests one box against every packed box (same rule as boxesIntersect: touching edges overlap).
+ *
+ * Vectorized where the build allows it (AVX: 8 boxes per step, SSE2: 4), scalar otherwise.
+ * Every path computes the box edges and comparisons exactly like boxesIntersect, so the hit
+ * mask is bit-identical to intersectBoxesScalar for all inputs (NaN included).
+ *
+ * @param hits Receives (count + 63) / 64 words: bit i of hits[i / 64] is set if box i overlaps (BitSet layout)
+ * @return Number of overlapping boxes
+ */
+size_t intersectBoxes(float x, float y, float width, float height, const BoxColumns& boxes, uint64_t* hits);
+
+/**
+ * Reference path of intersectBoxes: one boxesIntersect call per packed box.
+ */
+size_t intersectBoxesScalar(float x, float y, float width, float height, const BoxColumns& boxes, uint64_t* hits);
+
+/**
+ * @return Instruction set intersectBoxes was compiled for ("avx", "sse2" or "scalar")
+ */
+const char* boxKernelName();
+} // namespace logic
+
+#endif // PACMANGAME_BOXKERNEL_H
@@ -0,0 +1,85 @@
+#ifndef PACMANGAME_BYTESTREAM_H
+#define PACMANGAME_BYTESTREAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace logic {
+/**
+ * Appends compact binary values to a byte buffer (replay files, World keyframes).
+ *
+ * Encoding:
+ * - Varints: LEB128, 7 bits per byte (small values take one byte)
+ * - Signed varints: zigzag mapped first (small negative values stay small)
+ * - Fixed-size values (floats, 64-bit words): little endian, independent of host byte order
+ */
+class ByteWriter {
+private:
+    std::vector<uint8_t>& buffer;
+
+public:
+    explicit ByteWriter(std::vector<uint8_t>& buffer) : buffer(buffer) {}
+
+    void writeByte(uint8_t value) { buffer.push_back(value); }
+
+    void writeVarint(uint64_t value);
+
+    void writeSignedVarint(int64_t value);
+
+    void writeFloat(float value);
+
+    void writeFixed64(uint64_t value);
+
+    /**
+     * Length-prefixed (varint) bytes.
+     */
+    void writeString(const std::string& value);
+
+    void writeBytes(const uint8_t* data, size_t size);
+
+    size_t size() const { return buffer.size(); }
+};
+
+/**
+ * Reads values written by ByteWriter from a byte range (not owned).
+ *
+ * Every read is bounds checked: truncated or corrupt data throws instead of reading past the end.
+ */
+class ByteReader {
+private:
+    const uint8_t* data;
+    size_t size;
+    size_t position;
+
+    /**
+     * @throws std::runtime_error if fewer than count bytes remain
+     */
+    void require(size_t count) const;
+
+public:
+    ByteReader(const uint8_t* data, size_t size) : data(data), size(size), position(0) {}
+
+    uint8_t readByte();
+
+    uint64_t readVarint();
+
+    int64_t readSignedVarint();
+
+    float readFloat();
+
+    uint64_t readFixed64();
+
+    std::string readString();
+
+    /**
+     * @return Pointer to the next count bytes (valid as long as the underlying data)
+     */
+    const uint8_t* readBytes(size_t count);
+
+    bool atEnd() const { return position == size; }
+};
+} // namespace logic
+
+#endif // PACMANGAME_BYTESTREAM_H
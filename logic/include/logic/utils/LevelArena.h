@@ -0,0 +1,74 @@
+#ifndef PACMANGAME_LEVELARENA_H
+#define PACMANGAME_LEVELARENA_H
+
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+namespace logic {
+/**
+ * Level-scoped object arena (monotonic buffer).
+ *
+ * Every model and view of a level is placed here by the AbstractFactory: objects of one load
+ * sit next to each other in creation order (row-major over the map) instead of one heap block
+ * each, and a few large chunks replace tens of thousands of small allocations on big maps.
+ *
+ * Memory is only given back all at once by release() (World::clearWorld). Objects are still
+ * destroyed one by one through their owning pointers before that; destroying them frees nothing.
+ * Nothing created here may outlive the next release() or the arena itself.
+ *
+ * Thread-safety: One arena per World (no internal locking).
+ */
+class LevelArena {
+public:
+    /**
+     * Deleter for arena objects: runs the destructor only (virtual destructors dispatch as usual).
+     */
+    struct Destroyer {
+        template <typename T>
+        void operator()(T* object) const {
+            object->~T();
+        }
+    };
+
+private:
+    std::pmr::monotonic_buffer_resource resource;
+
+public:
+    LevelArena();
+
+    LevelArena(const LevelArena&) = delete;
+    LevelArena& operator=(const LevelArena&) = delete;
+
+    /**
+     * Shared object in the arena; the control block sits in the same arena block.
+     */
+    template <typename T, typename... Args>
+    std::shared_ptr<T> makeShared(Args&&... args) {
+        return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(&resource), std::forward<Args>(args)...);
+    }
+
+    /**
+     * Uniquely owned object in the arena (converts to a pointer to any base with a virtual destructor).
+     */
+    template <typename T, typename... Args>
+    std::unique_ptr<T, Destroyer> make(Args&&... args) {
+        void* memory = resource.allocate(sizeof(T), alignof(T));
+        return std::unique_ptr<T, Destroyer>(new (memory) T(std::forward<Args>(args)...));
+    }
+
+    /**
+     * Frees all arena memory in one shot. Every object created since the last release must be destroyed.
+     */
+    void release();
+};
+
+/**
+ * Owning pointer to an object created by LevelArena::make().
+ */
+template <typename T>
+using ArenaPtr = std::unique_ptr<T, LevelArena::Destroyer>;
+} // namespace logic
+
+#endif // PACMANGAME_LEVELARENA_H
@@ -1,38 +1,44 @@
 #ifndef PACMANGAME_RANDOM_H
 #define PACMANGAME_RANDOM_H
 
-#include <random>
+#include <cstdint>
 
 namespace logic {
 /**
- * Singleton random number generator using Mersenne Twister.
+ * Small, fast, seedable random number generator (PCG32, XSH-RR variant).
  *
- * Provides centralized RNG for game logic (ghost AI, spawning, etc.).
- * Seeded once at construction for deterministic-within-session randomness.
+ * Instance-based: every World owns its seed and every ghost draws from its own
+ * stream, so runs are reproducible from a single seed and separate Worlds can
+ * run on separate threads without sharing state.
  *
- * Thread-safety: Not thread-safe (single-threaded game loop).
+ * - seed: start position in the sequence
+ * - stream: selects one of 2^63 independent sequences for the same seed
+ *
+ * 16 bytes of state, no allocation, no distribution objects per call.
+ * Thread-safety: One instance per thread (no internal locking).
  */
 class Random {
 private:
-    static Random* instance;
-
-    Random();
-
-    std::mt19937 generator;
+    uint64_t state;
+    uint64_t increment; // Odd, derived from stream
 
 public:
-    static Random& getInstance();
-
-    Random(const Random&) = delete;
+    Random();
 
-    Random& operator=(const Random&) = delete;
+    explicit Random(uint64_t seed, uint64_t stream = 0);
 
-    Random(Random&&) = delete;
+    /**
+     * Restarts generator (same seed and stream → same sequence).
+     */
+    void seed(uint64_t seed, uint64_t stream = 0);
 
-    Random& operator=(Random&&) = delete;
+    /**
+     * @return Next uniformly distributed 32-bit value
+     */
+    uint32_t next();
 
     /**
-     * Generates random integer in range [min, max] (inclusive).
+     * Generates random integer in range [min, max] (inclusive), unbiased.
      */
     int getInt(int min, int max);
 
@@ -40,7 +46,27 @@ public:
      * Generates random float in range [min, max) (max exclusive).
      */
     float getFloat(float min, float max);
+
+    /**
+     * Non-deterministic seed from std::random_device (regular game sessions).
+     */
+    static uint64_t randomSeed();
+
+    /**
+     * Complete generator state (for World keyframes): restoring it continues the exact same sequence.
+     */
+    struct State {
+        uint64_t state;
+        uint64_t increment;
+    };
+
+    State getState() const { return {state, increment}; }
+
+    void setState(const State& newState) {
+        state = newState.state;
+        increment = newState.increment;
+    }
 };
 } // namespace logic
 
-#endif // PACMANGAME_RANDOM_H
\ No newline at end of file
+#endif // PACMANGAME_RANDOM_H
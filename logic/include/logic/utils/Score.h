@@ -77,6 +77,25 @@ public:
 
     ScoreEvent getLastEvent() const { return lastEvent; }
 
+    /**
+     * Running score state (high score file not included).
+     */
+    struct Snapshot {
+        int score;
+        float timeSinceLastCoin;
+        float accumulatedDecay;
+        ScoreEvent lastEvent;
+    };
+
+    Snapshot snapshot() const { return {score, timeSinceLastCoin, accumulatedDecay, lastEvent}; }
+
+    void restore(const Snapshot& snapshot) {
+        score = snapshot.score;
+        timeSinceLastCoin = snapshot.timeSinceLastCoin;
+        accumulatedDecay = snapshot.accumulatedDecay;
+        lastEvent = snapshot.lastEvent;
+    }
+
     /**
     * High score entry (name + score pair).
     */
@@ -11,6 +11,8 @@ namespace logic {
  * regardless of frame rate. Ensures consistent game speed across devices.
  *
  * Usage: Call update() each frame, use getDeltaTime() for movement calculations.
+ * The game feeds this delta into a fixed-timestep accumulator: logic advances in
+ * fixed ticks (FIXED_TICK by default, see Game::setTickRate).
  */
 class Stopwatch {
 private:
@@ -22,6 +24,9 @@ private:
     float deltaTime;
 
 public:
+    static constexpr int TICK_RATE = 120;                 // Simulation steps per second
+    static constexpr float FIXED_TICK = 1.0f / TICK_RATE; // Seconds per simulation step
+
     static Stopwatch& getInstance();
 
     Stopwatch(const Stopwatch&) = delete;
@@ -0,0 +1,61 @@
+#ifndef PACMANGAME_DISTANCEFIELD_H
+#define PACMANGAME_DISTANCEFIELD_H
+
+#include "logic/world/TileGrid.h"
+#include <cstdint>
+#include <vector>
+
+namespace logic {
+/**
+ * Breadth-first distance field over the ghost movement graph of a TileGrid.
+ *
+ * Stores for every cell the number of cell steps to the nearest source cell, following
+ * the precomputed ghost direction masks (walls and NoEntry barriers block, doors optionally).
+ * The graph is undirected (a cell is enterable from every open neighbour), so the same
+ * field gives the distance from any cell to the source.
+ *
+ * One compute() is O(cells) and reuses its buffers (no allocations after the first call);
+ * every lookup afterwards is O(1), shared by all ghosts reading the field.
+ */
+class DistanceField {
+public:
+    static constexpr uint16_t UNREACHABLE = 0xFFFF;
+
+private:
+    int width;
+    int height;
+    std::vector<uint16_t> distances;
+    std::vector<int> queue; // BFS frontier, kept between computes
+
+public:
+    DistanceField();
+
+    /**
+     * Recomputes distances from a single source cell (no-op for cells outside the grid).
+     *
+     * @param doorsBlock Passability class (see TileGrid::getGhostDirectionMask)
+     */
+    void compute(const TileGrid& grid, int sourceCol, int sourceRow, bool doorsBlock);
+
+    void clear();
+
+    /**
+     * @return Distance of cell to the source, UNREACHABLE outside the grid or when cut off by obstacles
+     */
+    uint16_t get(int col, int row) const {
+        if (col < 0 || col >= width || row < 0 || row >= height) {
+            return UNREACHABLE;
+        }
+        return distances[static_cast<size_t>(row) * width + col];
+    }
+
+    /**
+     * Distances of the four neighbours of (col, row), in MOVE_DIRECTIONS order.
+     */
+    DirectionDistances getNeighbours(int col, int row) const;
+
+    bool isEmpty() const { return distances.empty(); }
+};
+} // namespace logic
+
+#endif // PACMANGAME_DISTANCEFIELD_H
@@ -0,0 +1,158 @@
+#ifndef PACMANGAME_HIERARCHICALPATHFINDER_H
+#define PACMANGAME_HIERARCHICALPATHFINDER_H
+
+#include "logic/world/TileGrid.h"
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace logic {
+/**
+ * Hierarchical path distances (HPA*) over the ghost movement graph of a TileGrid.
+ *
+ * Built once per map: the grid is cut into CLUSTER_SIZE x CLUSTER_SIZE clusters. Border
+ * crossings between two clusters form an entrance when they join the same pair of
+ * in-cluster regions along an open border stretch (one transition in its middle, two at
+ * its ends when wide), and the transition cells of each cluster are joined by their
+ * in-cluster path lengths. The resulting abstract graph is a small fraction of the grid.
+ *
+ * A query runs weighted A* (Manhattan heuristic) over the abstract graph from the target's
+ * cluster to the querying cell's, refining both ends with a BFS bounded to their cluster.
+ * Cost grows with the distance between the two ends, not with the map size, so
+ * per-decision targets (PINK/BLUE predictions) stay cheap on very large mazes where one
+ * full-grid DistanceField per target would not.
+ *
+ * Distances are near-optimal: long paths are routed through transition cells, nearby
+ * targets also get an exact BFS bounded to a small window around both ends. Connected
+ * components are labelled at build, so unreachable targets are rejected in O(1). Query
+ * buffers are reused: no allocations after the first query.
+ */
+class HierarchicalPathfinder {
+public:
+    static constexpr int CLUSTER_SIZE = 10;
+    static constexpr uint16_t UNREACHABLE = 0xFFFF;
+
+    // Targets within CLUSTER_SIZE cells (per axis) are also searched exactly on the grid, inside the
+    // bounding box of both ends grown by CLUSTER_SIZE / 2: at most EXACT_WINDOW cells per side
+    static constexpr int EXACT_WINDOW = 2 * CLUSTER_SIZE + 1;
+
+private:
+    struct Node {
+        int col;
+        int row;
+        int localIndex; // Index in its cluster's distance buffer
+    };
+
+    struct Edge {
+        int target;
+        int cost;
+    };
+
+    struct OpenEntry {
+        int estimate;  // Cost so far + heuristic
+        int heuristic; // Ties go to the entry closer to the start (open mazes have many equal estimates)
+        int node;
+    };
+
+    int width;
+    int height;
+    int clustersX;
+    int clustersY;
+
+    std::vector<DirectionMask> masks; // Copied from the grid for the chosen passability class
+    std::vector<int> components;      // Connected component per cell
+
+    // Abstract graph (CSR): nodes of cluster c are clusterNodes[clusterNodeStart[c], clusterNodeStart[c + 1]),
+    // edges of node n are edges[edgeStart[n], edgeStart[n + 1])
+    std::vector<Node> nodes;
+    std::vector<int> clusterNodeStart;
+    std::vector<int> clusterNodes;
+    std::vector<int> edgeStart;
+    std::vector<Edge> edges;
+
+    // Query scratch, kept between queries
+    std::vector<int> localQueue;
+    std::vector<int> localDistances;     // Cluster-local BFS from a start cell
+    std::vector<int> goalLocalDistances; // Cluster-local BFS from the current target
+    std::vector<int> windowDistances;    // Exact BFS from a nearby target (EXACT_WINDOW stride)
+    std::vector<std::pair<int, int>> goalLinks;  // (node, distance to target)
+    std::vector<std::pair<int, int>> startLinks; // (node, distance from start) per neighbour, see startLinkEnd
+    int startLinkEnd[4];
+    int goalCell;
+
+    std::vector<int> nodeCosts;
+    std::vector<uint32_t> nodeStamps;   // nodeCosts valid when stamp == queryStamp
+    std::vector<uint32_t> closedStamps; // Node settled when stamp == queryStamp
+    std::vector<uint32_t> startStamps;  // Node linked to a start cell when stamp == queryStamp
+    std::vector<OpenEntry> open; // Min-heap
+    uint32_t queryStamp;
+
+    int clusterOf(int col, int row) const { return (row / CLUSTER_SIZE) * clustersX + col / CLUSTER_SIZE; }
+
+    /**
+     * BFS from (col, row) restricted to the area. Fills distances at (row - top) * stride + (col - left),
+     * -1 if not reached.
+     */
+    void searchArea(int left, int top, int areaWidth, int areaHeight, int stride, int col, int row,
+                    std::vector<int>& distances);
+
+    /**
+     * BFS from cell, restricted to the cell's cluster. Fills distances (cluster-local index, -1 if not reached).
+     */
+    void searchCluster(int col, int row, std::vector<int>& distances);
+
+    /**
+     * Cluster-local index of (col, row) in its cluster's distance buffer.
+     */
+    static int localIndex(int col, int row) { return (row % CLUSTER_SIZE) * CLUSTER_SIZE + col % CLUSTER_SIZE; }
+
+    void labelComponents();
+
+    /**
+     * Labels every cell with its region: the cells connected to it inside its cluster.
+     */
+    void labelRegions(std::vector<int>& regions);
+
+    void buildEntrances(const std::vector<int>& regions, std::vector<int>& nodeAtCell,
+                        std::vector<std::pair<int, Edge>>& links);
+
+    void buildIntraClusterEdges(std::vector<std::pair<int, Edge>>& links);
+
+    int addNode(int col, int row, std::vector<int>& nodeAtCell);
+
+    void prepareGoal(int targetCol, int targetRow);
+
+public:
+    HierarchicalPathfinder();
+
+    /**
+     * Builds the abstract graph. O(cells); call once per map after TileGrid::buildDirectionMasks().
+     *
+     * @param doorsBlock Passability class (see TileGrid::getGhostDirectionMask)
+     */
+    void build(const TileGrid& grid, bool doorsBlock);
+
+    void clear();
+
+    /**
+     * @return True if a path exists between both cells (false if either lies outside the grid)
+     */
+    bool isConnected(int col, int row, int otherCol, int otherRow) const;
+
+    /**
+     * Path distances from the four neighbours of (col, row) to the target cell, in MOVE_DIRECTIONS order.
+     *
+     * @return UNREACHABLE for neighbours outside the grid or without a path; long distances saturate
+     * at UNREACHABLE - 1
+     */
+    DirectionDistances getNeighbourDistances(int col, int row, int targetCol, int targetRow);
+
+    size_t getNodeCount() const { return nodes.size(); }
+
+    size_t getEdgeCount() const { return edges.size(); }
+
+    bool isEmpty() const { return masks.empty(); }
+};
+} // namespace logic
+
+#endif // PACMANGAME_HIERARCHICALPATHFINDER_H
@@ -0,0 +1,102 @@
+#ifndef PACMANGAME_INTERSECTIONGRAPH_H
+#define PACMANGAME_INTERSECTIONGRAPH_H
+
+#include "logic/world/TileGrid.h"
+#include <cstdint>
+#include <vector>
+
+namespace logic {
+/**
+ * Junction graph of the ghost movement grid.
+ *
+ * Nodes are the open cells where a ghost has a choice or must turn back: junctions (three or
+ * four exits) and dead ends. Every other open cell lies on a corridor (a straight run or a
+ * corner) with exactly two exits, so the path leaving a node through one exit always ends at
+ * a single other node. That path is stored as an edge with its length in cell steps.
+ *
+ * Built once per map. World only runs ghost AI when a ghost reaches a node; on corridor cells
+ * it just follows the corridor. Exits are symmetric (a cell counts as open towards a neighbour
+ * only if the neighbour is open too) and never leave the grid.
+ */
+class IntersectionGraph {
+public:
+    static constexpr int NO_NODE = -1;
+
+    struct Node {
+        int col;
+        int row;
+        DirectionMask exits;
+    };
+
+    /**
+     * Corridor leaving a node through one exit.
+     */
+    struct Edge {
+        int target;        // NO_NODE if the exit is closed or the corridor loops without reaching a node
+        int length;        // Cell steps to target
+        Direction arrival; // Direction of travel when entering target
+    };
+
+private:
+    int width;
+    int height;
+
+    std::vector<DirectionMask> exits; // Per cell, 0 for closed cells
+    std::vector<int> nodeAtCell;      // NO_NODE for corridor and closed cells
+    std::vector<Node> nodes;
+    std::vector<Edge> edges; // Four per node, in MOVE_DIRECTIONS order
+    size_t edgeCount;
+
+    void traceEdge(int node, int directionIndex);
+
+public:
+    IntersectionGraph();
+
+    /**
+     * Extracts nodes and edges. O(cells); call once per map after TileGrid::buildDirectionMasks().
+     *
+     * @param doorsBlock Passability class (see TileGrid::getGhostDirectionMask)
+     */
+    void build(const TileGrid& grid, bool doorsBlock);
+
+    void clear();
+
+    /**
+     * @return Open directions of (col, row), 0 outside the grid or for closed cells
+     */
+    DirectionMask getExits(int col, int row) const {
+        if (col < 0 || col >= width || row < 0 || row >= height) {
+            return 0;
+        }
+        return exits[static_cast<size_t>(row) * width + col];
+    }
+
+    /**
+     * @return Node at (col, row), NO_NODE outside the grid and for corridor or closed cells
+     */
+    int getNodeAt(int col, int row) const {
+        if (col < 0 || col >= width || row < 0 || row >= height) {
+            return NO_NODE;
+        }
+        return nodeAtCell[static_cast<size_t>(row) * width + col];
+    }
+
+    const Node& getNode(int node) const { return nodes[node]; }
+
+    /**
+     * Corridor leaving node in direction (target NO_NODE if that exit is closed).
+     */
+    const Edge& getEdge(int node, Direction direction) const;
+
+    size_t getNodeCount() const { return nodes.size(); }
+
+    /**
+     * @return Number of directed edges (each corridor counts once per end)
+     */
+    size_t getEdgeCount() const { return edgeCount; }
+
+    bool isEmpty() const { return exits.empty(); }
+};
+} // namespace logic
+
+#endif // PACMANGAME_INTERSECTIONGRAPH_H
@@ -0,0 +1,132 @@
+#ifndef PACMANGAME_LEVELSESSION_H
+#define PACMANGAME_LEVELSESSION_H
+
+#include "logic/replay/Replay.h"
+#include "logic/world/World.h"
+#include <memory>
+
+namespace logic {
+/**
+ * Outcome of one LevelSession step.
+ */
+enum class LevelStep {
+    COUNTDOWN,     // "READY!" pause, World not updated
+    RESPAWNED,     // PacMan respawned, respawn countdown started
+    PLAYING,       // World advanced one step
+    LEVEL_CLEARED, // All coins collected, next level loaded
+    GAME_OVER      // Lives depleted
+};
+
+/**
+ * Level flow around a World: countdowns, respawn pauses, level progression and game over.
+ *
+ * Shared by LevelState (windowed game) and the headless simulator so both
+ * advance the World with exactly the same rules. Presentation side effects
+ * (sounds, HUD, state transitions) are left to the caller based on the returned LevelStep.
+ *
+ * All player input goes through applyInput(), stamped with the current tick:
+ * - Recording: applied inputs are appended to a Replay
+ * - Playback: a Replay's inputs are applied at their tick, live input is ignored; seek() jumps via keyframes
+ */
+class LevelSession {
+private:
+    World& world;
+
+    bool countingDown;
+    float countdownTimer;
+
+    uint32_t tick; // Number of update() calls so far
+
+    std::unique_ptr<Replay> recording;
+    std::unique_ptr<Replay> playback;
+    size_t nextPlaybackInput;
+
+    void performInput(InputAction action);
+
+    /**
+     * Advances one tick (countdown, respawn pause or World step).
+     */
+    LevelStep step(float deltaTime);
+
+    /**
+     * Appends current session + World state as a keyframe of the recording.
+     */
+    void captureKeyframe();
+
+    void restoreKeyframe(const Keyframe& keyframe);
+
+public:
+    static constexpr float START_COUNTDOWN = 1.0f;   // "READY!" before first move
+    static constexpr float RESPAWN_COUNTDOWN = 1.0f; // Pause after death
+    static constexpr float LEVEL_COUNTDOWN = 2.0f;   // Pause between levels
+
+    explicit LevelSession(World& world);
+
+    /**
+     * Advances countdown or World by deltaTime.
+     *
+     * @return What happened during this step
+     */
+    LevelStep update(float deltaTime);
+
+    void startCountdown(float duration);
+
+    /**
+     * Awards LEVEL_CLEARED, loads next level and starts the level countdown.
+     */
+    void completeLevel();
+
+    /**
+     * Restarts the game in place (World::restart) with the start countdown. A recording starts over with the
+     * World's current seed, playback starts again from the first input.
+     */
+    void restart();
+
+    /**
+     * Applies player input before the next tick (arrow keys, cheat codes).
+     *
+     * Direction input is ignored when PacMan already moves that way.
+     * Ignored entirely during playback.
+     */
+    void applyInput(InputAction action);
+
+    /**
+     * Starts recording applied inputs (seed taken from World, tick duration from update()).
+     */
+    void startRecording(const std::string& mapFile);
+
+    /**
+     * Recording so far, with tickCount and finalChecksum of the current state. nullptr if not recording.
+     */
+    const Replay* finishRecording();
+
+    /**
+     * Replays recorded inputs from now on. World must be freshly loaded with the replay's map and seed.
+     */
+    void startPlayback(const Replay& replay);
+
+    /**
+     * Jumps playback to targetTick (clamped to the replay length).
+     *
+     * Restores the latest keyframe at or before targetTick and re-simulates the rest,
+     * so the cost is bounded by the replay's keyframe interval. Without a suitable keyframe
+     * playback can only move forward. No-op when not playing back.
+     */
+    void seek(uint32_t targetTick);
+
+    bool isPlayingBack() const { return playback != nullptr; }
+
+    /**
+     * @return Replay being played back, nullptr otherwise
+     */
+    const Replay* getPlayback() const { return playback.get(); }
+
+    uint32_t getTick() const { return tick; }
+
+    bool isCountingDown() const { return countingDown; }
+
+    bool isGameOver() const;
+};
+} // namespace logic
+
+#endif // PACMANGAME_LEVELSESSION_H
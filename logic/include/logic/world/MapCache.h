@@ -0,0 +1,90 @@
+#ifndef PACMANGAME_MAPCACHE_H
+#define PACMANGAME_MAPCACHE_H
+
+#include "logic/world/MapData.h"
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace logic {
+/**
+ * Process-wide singleton cache of loaded maps, keyed by path and file modification time.
+ *
+ * World::loadMap goes through it, so level restarts and new sessions of the same map reuse the
+ * parsed grid and spawn tables: a cache hit costs one stat() of the file, no read and no parsing.
+ * An edited map (other modification time or size) is loaded again on its next use.
+ *
+ * Thread safe (parallel simulations share it). Entries stay until clear(); the maps are
+ * immutable and only read while a World is built from them.
+ */
+class MapCache {
+public:
+    /**
+     * Modification time (ns on POSIX, file clock ticks elsewhere) and size of a map file.
+     */
+    struct FileStamp {
+        int64_t modified;
+        uintmax_t size;
+
+        bool operator==(const FileStamp& other) const {
+            return modified == other.modified && size == other.size;
+        }
+    };
+
+private:
+    struct Entry {
+        FileStamp stamp;
+        std::shared_ptr<const MapData> map;
+    };
+
+    std::unordered_map<std::string, Entry> entries;
+    mutable std::mutex mutex;
+
+    size_t hits;
+    size_t misses;
+
+    MapCache();
+
+public:
+    static MapCache& getInstance();
+
+    MapCache(const MapCache&) = delete;
+
+    MapCache& operator=(const MapCache&) = delete;
+
+    MapCache(MapCache&&) = delete;
+
+    MapCache& operator=(MapCache&&) = delete;
+
+    /**
+     * Cached map of filename, loaded (MapData::load) if missing or changed on disk.
+     *
+     * @throws std::runtime_error if the file cannot be read or is a corrupt compiled map
+     */
+    std::shared_ptr<const MapData> load(const std::string& filename);
+
+    /**
+     * Dimensions of filename from the cache if it's there and unchanged, MapData::readDimensions otherwise.
+     */
+    std::pair<int, int> getDimensions(const std::string& filename);
+
+    /**
+     * Drops all entries (Worlds built from them are unaffected).
+     */
+    void clear();
+
+    size_t size() const;
+
+    /**
+     * @return Number of load() calls served from the cache / that read the file
+     */
+    size_t getHits() const;
+
+    size_t getMisses() const;
+};
+} // namespace logic
+
+#endif // PACMANGAME_MAPCACHE_H
@@ -0,0 +1,157 @@
+#ifndef PACMANGAME_MAPDATA_H
+#define PACMANGAME_MAPDATA_H
+
+#include "logic/entities/EntityModel.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace logic {
+/**
+ * Parsed map: the static layout World::loadMap builds a level from.
+ *
+ * Two file formats, detected by content:
+ * - ASCII (source format, see World::loadMap for the symbols): parsed once into the compiled layout
+ * - Compiled (written by compile()): the same layout as a file, memory mapped and used in place
+ *   (no parsing, no copies; falls back to reading the file where mmap is unavailable)
+ *
+ * Compiled layout (host byte order, little endian in practice), every section 8-byte aligned:
+ * - Header: magic "PMAP", version, width, height, section sizes
+ * - Spawn table: cell index (row-major) of every cell that creates an entity, in creation order
+ * - Symbol layer: source symbol per cell
+ * - Tile layer: TileGrid flags per cell
+ * - Direction layer: TileGrid ghost direction masks, two per cell (see TileGrid::buildDirectionMasks)
+ *
+ * Immutable once loaded: one MapData can back any number of Worlds.
+ */
+class MapData {
+public:
+    static constexpr uint32_t FORMAT_VERSION = 1;
+
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        int32_t width;
+        int32_t height;
+        uint32_t spawnCount;
+        uint32_t wallCount;
+        uint32_t coinCount;
+        uint32_t fruitCount;
+        uint32_t ghostCount;
+        uint32_t reserved; // 0, keeps the header a multiple of 8 bytes
+    };
+
+private:
+    std::vector<uint64_t> ownedImage; // Parsed ASCII maps and the read fallback
+
+    // Compiled maps: mapping of the whole file, released by the destructor
+    void* mapping;
+    size_t mappingSize;
+
+    const uint8_t* image;
+    size_t imageSize;
+
+    const Header* header;
+    const uint32_t* spawnCells;
+    const char* symbols;
+    const uint8_t* tiles;
+    const DirectionMask* directionMasks;
+
+    MapData();
+
+    /**
+     * Builds the compiled layout from map text (lines split like std::getline).
+     */
+    void parseText(const char* text, size_t size);
+
+    /**
+     * Points the section pointers into image after validating it.
+     *
+     * @throws std::runtime_error if image is not a complete compiled map
+     */
+    void attachImage(const std::string& filename);
+
+public:
+    MapData(const MapData&) = delete;
+    MapData& operator=(const MapData&) = delete;
+
+    ~MapData();
+
+    /**
+     * Loads an ASCII or compiled map file.
+     *
+     * @throws std::runtime_error if the file cannot be read or is a corrupt compiled map
+     */
+    static std::shared_ptr<const MapData> load(const std::string& filename);
+
+    /**
+     * Parses ASCII map text.
+     */
+    static std::shared_ptr<const MapData> fromText(const std::string& text);
+
+    /**
+     * Writes the compiled layout of this map.
+     *
+     * @throws std::runtime_error if the file cannot be written
+     */
+    void save(const std::string& filename) const;
+
+    /**
+     * Map compiler: loads sourceFile (normally ASCII) and saves it compiled to outputFile.
+     */
+    static void compile(const std::string& sourceFile, const std::string& outputFile);
+
+    /**
+     * Dimensions of a map file without loading it: reads only the header of compiled maps,
+     * scans ASCII maps line by line without storing them.
+     *
+     * @return (width, height), (0, 0) if the file cannot be read
+     */
+    static std::pair<int, int> readDimensions(const std::string& filename);
+
+    /**
+     * @return True if filename starts with the compiled map magic
+     */
+    static bool isCompiled(const std::string& filename);
+
+    int getWidth() const { return header->width; }
+
+    int getHeight() const { return header->height; }
+
+    const Header& getHeader() const { return *header; }
+
+    size_t getSpawnCount() const { return header->spawnCount; }
+
+    /**
+     * Cell index (row * width + col) of the i-th entity-creating cell, row-major.
+     */
+    uint32_t getSpawnCell(size_t i) const { return spawnCells[i]; }
+
+    char getSymbol(size_t cell) const { return symbols[cell]; }
+
+    /**
+     * TileGrid flags per cell (width * height bytes).
+     */
+    const uint8_t* getTiles() const { return tiles; }
+
+    /**
+     * Ghost direction table per cell and passability class (2 * width * height masks).
+     */
+    const DirectionMask* getDirectionMasks() const { return directionMasks; }
+
+    /**
+     * @return Size of the compiled layout in bytes
+     */
+    size_t getImageSize() const { return imageSize; }
+
+    /**
+     * @return True if the layout is used in place from a memory mapped file
+     */
+    bool isMapped() const { return mapping != nullptr; }
+};
+} // namespace logic
+
+#endif // PACMANGAME_MAPDATA_H
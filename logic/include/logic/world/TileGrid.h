@@ -0,0 +1,156 @@
+#ifndef PACMANGAME_TILEGRID_H
+#define PACMANGAME_TILEGRID_H
+
+#include "logic/entities/GhostModel.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace logic {
+/**
+ * Static per-cell occupancy grid of the maze.
+ *
+ * Built once by World::loadMap, stores one flag byte per map cell:
+ * - WALL / DOOR / NO_ENTRY: obstacle present in cell
+ * - NO_ENTRY_<TYPE>: NoEntry barrier in cell blocks that ghost type
+ *
+ * Collision queries only inspect the cells an AABB overlaps, so their cost
+ * is independent of the number of walls in the maze.
+ *
+ * Cell (col, row) covers [-1 + col * cellWidth, -1 + (col + 1) * cellWidth]
+ * horizontally (same normalized space as entities). Cells outside the grid are empty.
+ *
+ * Also holds the ghost direction table: for every (cell, passability class) a
+ * DirectionMask of neighbour cells a ghost may move into. Built once per map.
+ */
+class TileGrid {
+public:
+    /**
+     * Inclusive range of cells, empty when minCol > maxCol or minRow > maxRow.
+     */
+    struct CellRange {
+        int minCol;
+        int maxCol;
+        int minRow;
+        int maxRow;
+    };
+
+    enum TileFlag : uint8_t {
+        WALL = 1 << 0,
+        DOOR = 1 << 1,
+        NO_ENTRY = 1 << 2,
+        NO_ENTRY_RED = 1 << 4,
+        NO_ENTRY_PINK = 1 << 5,
+        NO_ENTRY_BLUE = 1 << 6,
+        NO_ENTRY_ORANGE = 1 << 7,
+        NO_ENTRY_ALL = NO_ENTRY_RED | NO_ENTRY_PINK | NO_ENTRY_BLUE | NO_ENTRY_ORANGE
+    };
+
+private:
+    int width;
+    int height;
+    float cellWidth;
+    float cellHeight;
+
+    std::vector<uint8_t> tiles;
+
+    // Index: cell * 2 + (doorsBlock ? 1 : 0)
+    std::vector<DirectionMask> ghostDirectionMasks;
+
+public:
+    TileGrid();
+
+    /**
+     * Resizes grid to width x height empty cells covering normalized space [-1, 1].
+     */
+    void reset(int width, int height);
+
+    void clear();
+
+    /**
+     * Replaces the grid with precomputed layers (compiled maps, see MapData): width * height flag bytes
+     * and the matching direction table of buildDirectionMasks() (two masks per cell).
+     */
+    void assign(int width, int height, const uint8_t* tiles, const DirectionMask* directionMasks);
+
+    void addFlags(int col, int row, uint8_t flags);
+
+    /**
+     * @return Flags of cell, 0 for cells outside the grid
+     */
+    uint8_t getFlags(int col, int row) const;
+
+    /**
+     * Cells (clamped to the grid) an AABB touches, edge-touching included.
+     */
+    CellRange getOverlappedCells(float left, float right, float top, float bottom) const;
+
+    /**
+     * Tests whether an AABB touches any cell carrying one of the given flags.
+     *
+     * Edge-touching counts as overlap (same semantics as EntityModel::intersects).
+     *
+     * @param flagMask Combination of TileFlag values to test for
+     * @return true if any overlapped cell has (flags & flagMask) != 0
+     */
+    bool overlaps(float left, float right, float top, float bottom, uint8_t flagMask) const;
+
+    /**
+     * Precomputes ghost direction masks for every cell and both passability classes.
+     *
+     * A direction is open if the neighbour cell has no wall or NoEntry barrier
+     * (and no door when doors block). Call after all flags are added.
+     */
+    void buildDirectionMasks();
+
+    /**
+     * Directions a ghost centred in (col, row) can move in.
+     *
+     * @param doorsBlock True for ghosts that already left the spawn area
+     * @return Precomputed mask, all directions for cells outside the grid
+     */
+    DirectionMask getGhostDirectionMask(int col, int row, bool doorsBlock) const {
+        if (!contains(col, row) || ghostDirectionMasks.empty()) {
+            return ALL_DIRECTIONS_MASK;
+        }
+        return ghostDirectionMasks[(static_cast<size_t>(row) * width + col) * 2 + (doorsBlock ? 1 : 0)];
+    }
+
+    float getCellCenterX(int col) const { return -1.0f + cellWidth / 2.0f + col * cellWidth; }
+
+    float getCellCenterY(int row) const { return -1.0f + cellHeight / 2.0f + row * cellHeight; }
+
+    /**
+     * NoEntry flag bit that blocks the given ghost type.
+     */
+    static uint8_t noEntryFlagFor(GhostType type);
+
+    int columnAt(float x) const;
+
+    int rowAt(float y) const;
+
+    int cellIndex(int col, int row) const { return row * width + col; }
+
+    bool contains(int col, int row) const { return col >= 0 && col < width && row >= 0 && row < height; }
+
+    int getWidth() const { return width; }
+
+    int getHeight() const { return height; }
+
+    float getCellWidth() const { return cellWidth; }
+
+    float getCellHeight() const { return cellHeight; }
+
+    /**
+     * Flag bytes, row-major (width * height).
+     */
+    const uint8_t* getTileData() const { return tiles.data(); }
+
+    /**
+     * Direction table, two masks per cell (empty before buildDirectionMasks()).
+     */
+    const DirectionMask* getDirectionMaskData() const { return ghostDirectionMasks.data(); }
+};
+} // namespace logic
+
+#endif // PACMANGAME_TILEGRID_H
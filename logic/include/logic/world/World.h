@@ -6,11 +6,20 @@
 #include "logic/entities/EntityModel.h"
 #include "logic/entities/FruitModel.h"
 #include "logic/entities/GhostModel.h"
+#include "logic/entities/MovingEntityStore.h"
 #include "logic/entities/NoEntryModel.h"
 #include "logic/entities/PacManModel.h"
 #include "logic/patterns/AbstractFactory.h"
 #include "logic/patterns/Observer.h"
+#include "logic/utils/BitSet.h"
+#include "logic/utils/ByteStream.h"
+#include "logic/utils/LevelArena.h"
 #include "logic/utils/Score.h"
+#include "logic/world/DistanceField.h"
+#include "logic/world/HierarchicalPathfinder.h"
+#include "logic/world/IntersectionGraph.h"
+#include "logic/world/MapData.h"
+#include "logic/world/TileGrid.h"
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -30,6 +39,8 @@ namespace logic {
  *
  * Coordinate system: Normalized [-1, 1] for resolution independence.
  * Uses predictive collision detection (validates movement before applying).
+ * Static obstacles are resolved through a TileGrid built at load time.
+ * All randomness comes from per-ghost Random streams derived from the World seed.
  */
 
 class PacManModel;
@@ -37,14 +48,47 @@ class WallModel;
 class CoinModel;
 
 class World {
+public:
+    /**
+     * Complete mutable simulation state as plain values: the content of writeState without encoding.
+     *
+     * Static layout stays with the map, so a Snapshot only restores into a World with the same map
+     * loaded. Holds no entity pointers; ghosts and pickup bitsets are flat arrays whose buffers are
+     * kept when a Snapshot is reused, so repeated snapshot() calls into it don't allocate.
+     * Used for rollback, rewinding and AI lookahead.
+     */
+    struct Snapshot {
+        Score::Snapshot score;
+        int level;
+        int deaths;
+        bool hasJustRespawned;
+        bool fearModeActive;
+        float fearModeTimer;
+        float baseGhostSpeed;
+        float baseFearDuration;
+
+        bool hasPacMan;
+        PacManModel::Snapshot pacman; // Unused without PacMan
+
+        std::vector<GhostModel::Snapshot> ghosts; // In load order
+        std::vector<uint64_t> coinWords;          // BitSet words of the collection state
+        std::vector<uint64_t> fruitWords;
+    };
+
 private:
+    // Backs every model and view of the loaded level; declared first so it is destroyed last
+    LevelArena arena;
+
+    // Hot state of PacMan and ghosts (ghost i in slot i, then PacMan); outlives the models
+    MovingEntityStore movingEntities;
+
     std::vector<std::shared_ptr<EntityModel>> entities;
-    std::vector<std::unique_ptr<Observer>> wallViews;
-    std::vector<std::unique_ptr<Observer>> coinViews;
-    std::vector<std::unique_ptr<Observer>> fruitViews;
-    std::vector<std::unique_ptr<Observer>> doorViews;
-    std::vector<std::unique_ptr<Observer>> ghostViews;
-    std::unique_ptr<Observer> pacmanView;
+    std::vector<ArenaPtr<Observer>> wallViews;
+    std::vector<ArenaPtr<Observer>> coinViews;
+    std::vector<ArenaPtr<Observer>> fruitViews;
+    std::vector<ArenaPtr<Observer>> doorViews;
+    std::vector<ArenaPtr<Observer>> ghostViews;
+    ArenaPtr<Observer> pacmanView;
 
     AbstractFactory* factory;
 
@@ -56,7 +100,31 @@ private:
     std::vector<std::shared_ptr<NoEntryModel>> noEntries;
     std::vector<std::shared_ptr<FruitModel>> fruits;
 
-    int coinsCollected;
+    TileGrid tileGrid;
+
+    // Path distances to PacMan, recomputed only when PacMan enters another cell (-1 = not computed)
+    DistanceField pacmanDistanceField;
+    int pacmanFieldCell;
+
+    // Per-map distances to each distinct eaten respawn cell (doors open), built once at load
+    std::vector<DistanceField> ghostHomeFields;
+    std::vector<int> ghostHomeCells;
+
+    // Abstract ghost movement graph (doors closed) for per-ghost chase targets, built once at load
+    HierarchicalPathfinder ghostPathfinder;
+
+    // Junctions and corridors (doors closed): exited ghosts only decide at nodes, built once at load
+    IntersectionGraph intersectionGraph;
+
+    // Pickups indexed by grid cell (-1 = none), collection state as dense bitsets
+    std::vector<int> coinIndexByCell;
+    std::vector<int> fruitIndexByCell;
+    BitSet coinCollection;
+    BitSet fruitCollection;
+
+    // PacMan-ghost box overlaps of the current frame (bit i = ghost i), filled by intersectBoxes
+    BitSet ghostContacts;
+
     Score score;
     Subject scoreSubject;
 
@@ -70,12 +138,118 @@ private:
     float fearModeTimer;
 
     int currentLevel;
+    int deaths;
     float baseGhostSpeed;
     float baseFearDuration;
 
+    uint64_t seed;
+
+    // Per ghost: simulation time of its next AI step (see getNextDecisionDelay), infinity when idle
+    std::vector<double> ghostDecisionTimes;
+    double simulationTime; // Sum of update() deltas
+
+    // State right after the last loadMap, target of restart()
+    Snapshot pristineState;
+
+    /**
+     * Reseeds every ghost's Random from the world seed, stream = ghost index + 1.
+     */
+    void seedGhostStreams();
+
+    /**
+     * Recomputes the PacMan distance field if PacMan changed cell since the last computation.
+     */
+    void updatePacManDistanceField();
+
+    /**
+     * Cell PINK and BLUE chase: 4 cells ahead of PacMan in its facing direction, pulled back towards
+     * PacMan until it lies in a cell connected to PacMan's (the prediction often ends in a wall).
+     *
+     * @return false if PacMan is missing or outside the grid
+     */
+    bool predictPacManCell(int& col, int& row) const;
+
+    /**
+     * Path distances from the neighbours of ghost's cell to its chase target: the predicted
+     * PacMan cell (pathfinder query) for chasing PINK/BLUE, PacMan's cell (distance field) otherwise.
+     */
+    DirectionDistances getGhostTargetDistances(const GhostModel& ghost);
+
+    /**
+     * Builds ghostHomeFields for the eaten respawn cells of all loaded ghosts.
+     */
+    void buildGhostHomeFields();
+
+    /**
+     * @return Field leading to ghost's eaten respawn cell, nullptr if it lies outside the grid
+     */
+    const DistanceField* getGhostHomeField(const GhostModel& ghost) const;
+
+    /**
+     * EATEN ghost step: follows the home field cell center to cell center (one lookup per cell)
+     * until it reaches the respawn cell. Returns false if the ghost has no path home.
+     */
+    bool returnGhostHome(GhostModel& ghost, float deltaTime);
+
+    /**
+     * Direction choice for an exited CHASING/FEAR ghost, driven by the intersection graph: on corridor
+     * cells the ghost only turns where the corridor bends (no AI), at a node it runs its AI once per
+     * visit, as soon as it is aligned with every exit of the node.
+     */
+    void steerAlongIntersectionGraph(GhostModel& ghost);
+
+    /**
+     * Runs the ghost type's AI over the given options (target distances and PacMan's position).
+     */
+    void decideGhostDirection(GhostModel& ghost, DirectionMask viableDirections);
+
+    /**
+     * Direction step of a CHASING/FEAR ghost: picks a direction when stopped, then steers (intersection
+     * graph once exited, per-frame viability probing inside the spawn area).
+     */
+    void runGhostDecision(GhostModel& ghost);
+
+    /**
+     * Time until ghost's steering can act next: its speed against the distance to the alignment window of
+     * the next bend, node or wall ahead on the graph. Never late (waking early is harmless).
+     *
+     * @return Seconds, 0 for the next frame (no graph, inside the spawn area, stopped), negative when the
+     * ghost's state needs no AI
+     */
+    double getNextDecisionDelay(const GhostModel& ghost) const;
+
+    /**
+     * Makes every ghost's AI step due now (after changes to all ghosts, or to state not tracked by the schedule).
+     */
+    void scheduleAllGhostDecisions();
+
     void handlePacManDeath();
     void resetAfterDeath();
 
+    /**
+     * Per-frame PacMan step: buffered input, movement, wall/door collision,
+     * ghost contact and pickups.
+     */
+    void updatePacMan(PacManModel& pm, float deltaTime);
+
+    /**
+     * Per-frame ghost step: movement and obstacle collision (update() runs the AI step when due).
+     */
+    void updateGhost(GhostModel& ghost, float deltaTime);
+
+    /**
+     * Tests entity's bounding box, shifted by (offsetX, offsetY), against the tile grid.
+     *
+     * @param flags TileGrid::TileFlag combination counted as obstacles
+     * @return true if the shifted box touches a cell with any of the flags
+     */
+    bool overlapsTiles(const MovingEntityModel& entity, float offsetX, float offsetY, uint8_t flags) const;
+
+    /**
+     * Collects coins/fruits in the cells PacMan's bounding box overlaps.
+     */
+    void collectPickups(PacManModel& pm);
+
 public:
     World();
 
@@ -97,16 +271,53 @@ public:
      *
      * Converts ASCII grid to normalized coordinates [-1, 1].
      * Creates entities via AbstractFactory (attaches views automatically).
+     * Factories may return no view (NullFactory): such entities are simulated but never drawn.
+     * Models and views are placed in the World's level arena, released by the next clearWorld().
+     *
+     * Accepts compiled maps too (see MapData), which load without parsing. Maps come from MapCache:
+     * reloading an unchanged file (level restart, new session) doesn't read or parse it again.
      *
      * @param filename Path to map file (e.g., "resources/maps/map")
      * @throws std::runtime_error if file not found
      */
     void loadMap(const std::string& filename);
 
-    std::shared_ptr<PacManModel> getPacMan();
+    /**
+     * Builds the level from an already loaded map (grid layers are copied, entities created per spawn cell).
+     */
+    void loadMap(const MapData& map);
+
+    /**
+     * @return PacMan of the loaded level (arena object: don't keep it past the next loadMap or clearWorld)
+     */
+    std::shared_ptr<PacManModel> getPacMan() const;
 
+    /**
+     * Map size in cells without loading it (cached maps: no file access, compiled maps: header only).
+     * Prefer getTileGrid() once loaded.
+     *
+     * @return (width, height), (0, 0) if the file cannot be read
+     */
     static std::pair<int, int> getMapDimensions(const std::string& filename);
 
+    const TileGrid& getTileGrid() const { return tileGrid; }
+
+    /**
+     * Positions, sizes, speeds, directions and states of PacMan and the ghosts (ghost i in slot i).
+     */
+    const MovingEntityStore& getMovingEntities() const { return movingEntities; }
+
+    /**
+     * Path distances (ghost movement graph, doors closed) from every cell to PacMan's cell
+     * as of the last update(). Read by chasing and fleeing ghosts.
+     */
+    const DistanceField& getPacManDistanceField() const { return pacmanDistanceField; }
+
+    /**
+     * Junction nodes and corridor edges of the loaded map (ghost movement graph, doors closed).
+     */
+    const IntersectionGraph& getIntersectionGraph() const { return intersectionGraph; }
+
     /**
      * Predictive collision detection for PacMan's next direction.
      *
@@ -118,23 +329,45 @@ public:
      */
     bool isDirectionValid(Direction direction) const;
 
-    Direction getViableDirectionForGhost(std::shared_ptr<GhostModel> ghost) const;
+    /**
+     * Picks a random viable direction for ghost (used when ghost is stopped).
+     * Draws from the ghost's own random stream.
+     */
+    Direction getViableDirectionForGhost(GhostModel& ghost) const;
 
     /**
      * Returns all collision-free directions for ghost at current position.
      *
-     * Used by ghost AI to determine valid movement options at intersections.
-     * Checks walls, doors (ghost state dependent), and NoEntry barriers.
+     * Single lookup in the per-map direction table (TileGrid), keyed by the ghost's
+     * cell and passability class (doors block only ghosts that left the spawn).
+     * Perpendicular turns are only offered while the ghost is aligned with its cell center.
      *
      * @param ghost Ghost to check viable directions for
-     * @return Vector of directions that don't collide with obstacles
+     * @return Mask of directions that don't lead into obstacles
      */
-    std::vector<Direction> getViableDirectionsForGhost(std::shared_ptr<GhostModel> ghost) const;
+    DirectionMask getViableDirectionMask(const GhostModel& ghost) const;
 
+    /**
+     * Destroys all entities and views (views first, they detach from their models), then frees
+     * the level arena in one shot. Pointers obtained from this World (getPacMan()) die here too.
+     */
     void clearWorld();
 
-    void notifyViewsOnly();
+    /**
+     * Marks start of a simulation tick: current positions of moving entities
+     * (PacMan, ghosts) become their previous-tick positions (one pass over the MovingEntityStore).
+     *
+     * Called by update(); call directly for ticks that don't update the World
+     * (countdowns, pauses) so views stop interpolating.
+     */
+    void storePreviousPositions();
 
+    /**
+     * Draws all views once in layer order (doors, walls, coins, fruits, ghosts, PacMan).
+     *
+     * Not called by update(): simulation and presentation are separate, the owning
+     * state renders exactly once per displayed frame.
+     */
     void renderInOrder();
 
     void activateFearMode();
@@ -143,7 +376,7 @@ public:
 
     void clearRespawnFlag() { hasJustRespawned = false; }
 
-    int getCoinsCollected() const { return coinsCollected; }
+    int getCoinsCollected() const { return static_cast<int>(coinCollection.count()); }
 
     int getTotalCoins() const { return static_cast<int>(coins.size()); }
 
@@ -155,7 +388,65 @@ public:
 
     int getCurrentLevel() const { return currentLevel; }
 
+    int getDeaths() const { return deaths; }
+
+    /**
+     * Seeds all randomness of this World (ghost AI). Same seed + same input → same game.
+     *
+     * Applies to loaded ghosts immediately and to ghosts of later loadMap calls.
+     * Defaults to a non-deterministic seed.
+     */
+    void setSeed(uint64_t newSeed);
+
+    uint64_t getSeed() const { return seed; }
+
+    /**
+     * FNV-1a hash of the simulation state (score, level, fear mode, moving entities, pickups).
+     *
+     * Used by replays to verify that playback reproduced the recorded game bit for bit.
+     */
+    uint64_t checksum() const;
+
+    /**
+     * Copies the simulation state into out, reusing its buffers.
+     */
+    void snapshot(Snapshot& out) const;
+
+    Snapshot snapshot() const;
+
+    /**
+     * Restores a state taken with snapshot(). Positions are restored without interpolation,
+     * every ghost's AI step becomes due on the next update(). Views are not notified: the next
+     * render pass draws the restored state.
+     *
+     * @throws std::runtime_error if the snapshot doesn't match the loaded map (World left unchanged)
+     */
+    void restore(const Snapshot& snapshot);
+
+    /**
+     * Appends the complete mutable simulation state (replay keyframe): score, level, fear mode,
+     * moving entities including their random streams, and pickup collection.
+     *
+     * Static layout (walls, spawns, pickup positions) comes from the map and is not written,
+     * so a keyframe is a few hundred bytes. Encodes snapshot() with varints and packed flags.
+     */
+    void writeState(ByteWriter& writer) const;
+
+    /**
+     * Restores a state written by writeState. Positions are restored without interpolation.
+     *
+     * @throws std::runtime_error if the data is truncated or doesn't match the loaded map (World left unchanged)
+     */
+    void readState(ByteReader& reader);
+
     void nextLevel();
+
+    /**
+     * Warm restart: resets the World in place to the state right after the last loadMap, reseeding
+     * ghost randomness from the current seed. Entities, views and per-map structures are kept, nothing
+     * is allocated; equivalent to a new World loading the same map with the same seed.
+     */
+    void restart();
 };
 } // namespace logic
 
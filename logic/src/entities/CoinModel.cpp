@@ -2,16 +2,27 @@
 
 namespace logic {
 CoinModel::CoinModel(float x, float y, float width, float height)
-    : EntityModel(x, y, width, height), collected(false) {}
+    : StaticEntityModel(x, y, width, height), collectionState(nullptr), collectionIndex(0) {}
 
 void CoinModel::update(float /*deltaTime*/) {
 }
 
-bool CoinModel::isCollected() const { return collected; }
+void CoinModel::bindCollectionState(BitSet* state, size_t index) {
+    collectionState = state;
+    collectionIndex = index;
+}
+
+bool CoinModel::isCollected() const { return collectionState && collectionState->test(collectionIndex); }
 
 void CoinModel::collect() {
-    collected = true;
+    if (collectionState) {
+        collectionState->set(collectionIndex);
+    }
 }
 
-void CoinModel::uncollect() { collected = false; }
+void CoinModel::uncollect() {
+    if (collectionState) {
+        collectionState->reset(collectionIndex);
+    }
+}
 } // namespace logic
\ No newline at end of file
@@ -1,7 +1,7 @@
 #include "logic/entities/DoorModel.h"
 
 namespace logic {
-DoorModel::DoorModel(float x, float y, float width, float height) : EntityModel(x, y, width, height) {}
+DoorModel::DoorModel(float x, float y, float width, float height) : StaticEntityModel(x, y, width, height) {}
 
 DoorModel::~DoorModel() {}
 
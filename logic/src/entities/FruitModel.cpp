@@ -2,14 +2,27 @@
 
 namespace logic {
 FruitModel::FruitModel(float x, float y, float width, float height)
-    : EntityModel(x, y, width, height), collected(false) {}
+    : StaticEntityModel(x, y, width, height), collectionState(nullptr), collectionIndex(0) {}
 
 void FruitModel::update(float /*deltaTime*/) {
 }
 
-bool FruitModel::isCollected() const { return collected; }
+void FruitModel::bindCollectionState(BitSet* state, size_t index) {
+    collectionState = state;
+    collectionIndex = index;
+}
+
+bool FruitModel::isCollected() const { return collectionState && collectionState->test(collectionIndex); }
 
-void FruitModel::collect() { collected = true; }
+void FruitModel::collect() {
+    if (collectionState) {
+        collectionState->set(collectionIndex);
+    }
+}
 
-void FruitModel::uncollect() { collected = false; }
+void FruitModel::uncollect() {
+    if (collectionState) {
+        collectionState->reset(collectionIndex);
+    }
+}
 } // namespace logic
\ No newline at end of file
@@ -1,23 +1,24 @@
 #include "logic/entities/GhostModel.h"
 #include "logic/utils/Random.h"
-#include <algorithm>
+#include "logic/world/DistanceField.h"
 #include <cmath>
-#include <vector>
 
 namespace logic {
-GhostModel::GhostModel(float x, float y, float width, float height, GhostType type, float spawnDelay)
-    : EntityModel(x, y, width, height), type(type), state(GhostState::SPAWNING), spawnDelay(spawnDelay),
-      spawnTimer(0.0f), speed(0.5f), targetSpeed(0.5f), currentDirection(Direction::NONE), cellWidth(0.0f),
-      cellHeight(0.0f), hasExitedSpawn(false), eatenRespawnX(x), eatenRespawnY(y), exitStepCounter(0), fearTimer(0.0f),
-      respawnFlickerTimer(0.0f), respawnFlickerCount(0) {}
+GhostModel::GhostModel(MovingEntityStore& store, float x, float y, float width, float height, GhostType type,
+                       float spawnDelay)
+    : MovingEntityModel(store, x, y, width, height, 0.5f), type(type), spawnDelay(spawnDelay), spawnTimer(0.0f),
+      targetSpeed(0.5f), cellWidth(0.0f), cellHeight(0.0f), hasExitedSpawn(false), eatenRespawnX(x), eatenRespawnY(y),
+      exitTimer(0.0f), fearTimer(0.0f), respawnFlickerTimer(0.0f), respawnFlickerCount(0), decisionNode(-1) {
+    setState(GhostState::SPAWNING);
+}
 
 void GhostModel::update(float deltaTime) {
-    if (state == GhostState::SPAWNING) {
+    if (getState() == GhostState::SPAWNING) {
         spawnTimer += deltaTime;
 
         if (spawnTimer >= spawnDelay) {
             if (type == GhostType::RED && hasExitedSpawn) {
-                state = GhostState::CHASING;
+                setState(GhostState::CHASING);
             } else {
                 startExitingSpawn();
             }
@@ -25,39 +26,37 @@ void GhostModel::update(float deltaTime) {
         return;
     }
 
-    if (state == GhostState::EATEN) {
-        float moveDistance = speed * deltaTime;
-        float newX = x;
-        float newY = y;
+    if (getState() == GhostState::EATEN) {
+        float moveDistance = getSpeed() * deltaTime;
+        float newX = getX();
+        float newY = getY();
 
-        float dx = eatenRespawnX - x;
-        float dy = eatenRespawnY - y;
+        float dx = eatenRespawnX - getX();
+        float dy = eatenRespawnY - getY();
 
         // Threshold prevents oscillation when approaching spawn point
         const float SPAWN_THRESHOLD = 0.05f;
         if (std::abs(dx) < SPAWN_THRESHOLD && std::abs(dy) < SPAWN_THRESHOLD) {
-            setPosition(eatenRespawnX, eatenRespawnY);
-            state = GhostState::RESPAWNING;
-            respawnFlickerTimer = 0.0f;
-            respawnFlickerCount = 0;
+            arriveAtSpawn();
             return;
         }
 
-        // Simple greedy pathfinding (dominant axis first)
+        // Fallback only (World steers along the maze when the map has a path home):
+        // greedy straight line, dominant axis first
         if (std::abs(dx) > std::abs(dy)) {
             if (dx > 0) {
-                currentDirection = Direction::RIGHT;
+                setCurrentDirection(Direction::RIGHT);
                 newX += moveDistance;
             } else {
-                currentDirection = Direction::LEFT;
+                setCurrentDirection(Direction::LEFT);
                 newX -= moveDistance;
             }
         } else {
             if (dy > 0) {
-                currentDirection = Direction::DOWN;
+                setCurrentDirection(Direction::DOWN);
                 newY += moveDistance;
             } else {
-                currentDirection = Direction::UP;
+                setCurrentDirection(Direction::UP);
                 newY -= moveDistance;
             }
         }
@@ -66,7 +65,7 @@ void GhostModel::update(float deltaTime) {
         return;
     }
 
-    if (state == GhostState::RESPAWNING) {
+    if (getState() == GhostState::RESPAWNING) {
         respawnFlickerTimer += deltaTime;
 
         // 6 flickers × 0.3s = 1.8s visual feedback before exiting
@@ -84,100 +83,104 @@ void GhostModel::update(float deltaTime) {
     }
 
     // Hardcoded exit routes per ghost type (spawn area navigation)
-    if (state == GhostState::EXITING_SPAWN) {
-        float moveDistance = speed * deltaTime;
-        float newX = x;
-        float newY = y;
+    if (getState() == GhostState::EXITING_SPAWN) {
+        // Seconds per route leg (formerly 16 and 11 ticks at 120 Hz), so the route ignores the tick rate
+        const float EXIT_UP_DURATION = 0.13f;
+        const float EXIT_SIDE_DURATION = 0.09f;
+
+        float moveDistance = getSpeed() * deltaTime;
+        float newX = getX();
+        float newY = getY();
 
         if (type == GhostType::RED) {
-            if (currentDirection == Direction::NONE) {
-                currentDirection = Direction::UP;
+            if (getCurrentDirection() == Direction::NONE) {
+                setCurrentDirection(Direction::UP);
             }
 
-            if (currentDirection == Direction::UP) {
-                exitStepCounter++;
-                if (exitStepCounter > 15) {
-                    currentDirection = Direction::LEFT;
-                    exitStepCounter = 0;
+            if (getCurrentDirection() == Direction::UP) {
+                exitTimer += deltaTime;
+                if (exitTimer > EXIT_UP_DURATION) {
+                    setCurrentDirection(Direction::LEFT);
+                    exitTimer = 0.0f;
                 }
             }
 
-            if (currentDirection == Direction::LEFT) {
-                exitStepCounter++;
-                if (exitStepCounter > 10) {
-                    state = GhostState::CHASING;
+            if (getCurrentDirection() == Direction::LEFT) {
+                exitTimer += deltaTime;
+                if (exitTimer > EXIT_SIDE_DURATION) {
+                    setState(GhostState::CHASING);
                     hasExitedSpawn = true;
-                    exitStepCounter = 0;
+                    exitTimer = 0.0f;
                 }
             }
         }
 
         if (type == GhostType::PINK) {
-            if (currentDirection == Direction::NONE) {
-                currentDirection = Direction::UP;
+            if (getCurrentDirection() == Direction::NONE) {
+                setCurrentDirection(Direction::UP);
             }
 
-            if (currentDirection == Direction::UP) {
-                exitStepCounter++;
-                if (exitStepCounter > 15) {
-                    currentDirection = Direction::LEFT;
-                    exitStepCounter = 0;
+            if (getCurrentDirection() == Direction::UP) {
+                exitTimer += deltaTime;
+                if (exitTimer > EXIT_UP_DURATION) {
+                    setCurrentDirection(Direction::LEFT);
+                    exitTimer = 0.0f;
                 }
             }
 
-            if (currentDirection == Direction::LEFT) {
-                exitStepCounter++;
-                if (exitStepCounter > 10) {
-                    state = GhostState::CHASING;
+            if (getCurrentDirection() == Direction::LEFT) {
+                exitTimer += deltaTime;
+                if (exitTimer > EXIT_SIDE_DURATION) {
+                    setState(GhostState::CHASING);
                     hasExitedSpawn = true;
-                    exitStepCounter = 0;
+                    exitTimer = 0.0f;
                 }
             }
         }
 
         if (type == GhostType::BLUE) {
-            if (currentDirection == Direction::NONE) {
-                currentDirection = Direction::RIGHT;
+            if (getCurrentDirection() == Direction::NONE) {
+                setCurrentDirection(Direction::RIGHT);
             }
 
-            if (currentDirection == Direction::UP) {
-                exitStepCounter++;
-                if (exitStepCounter > 15) {
-                    currentDirection = Direction::RIGHT;
-                    exitStepCounter = 0;
+            if (getCurrentDirection() == Direction::UP) {
+                exitTimer += deltaTime;
+                if (exitTimer > EXIT_UP_DURATION) {
+                    setCurrentDirection(Direction::RIGHT);
+                    exitTimer = 0.0f;
                 }
             }
 
-            if (currentDirection == Direction::RIGHT && exitStepCounter > 0) {
-                exitStepCounter++;
-                if (exitStepCounter > 10) {
-                    state = GhostState::CHASING;
+            if (getCurrentDirection() == Direction::RIGHT && exitTimer > 0.0f) {
+                exitTimer += deltaTime;
+                if (exitTimer > EXIT_SIDE_DURATION) {
+                    setState(GhostState::CHASING);
                     hasExitedSpawn = true;
-                    exitStepCounter = 0;
+                    exitTimer = 0.0f;
                 }
             }
         }
 
         if (type == GhostType::ORANGE) {
-            if (currentDirection == Direction::NONE) {
-                currentDirection = Direction::LEFT;
+            if (getCurrentDirection() == Direction::NONE) {
+                setCurrentDirection(Direction::LEFT);
             }
 
-            if (currentDirection == Direction::LEFT && exitStepCounter > 0) {
-                exitStepCounter++;
-                if (exitStepCounter > 10) {
-                    state = GhostState::CHASING;
+            if (getCurrentDirection() == Direction::LEFT && exitTimer > 0.0f) {
+                exitTimer += deltaTime;
+                if (exitTimer > EXIT_SIDE_DURATION) {
+                    setState(GhostState::CHASING);
                     hasExitedSpawn = true;
-                    exitStepCounter = 0;
+                    exitTimer = 0.0f;
                 }
             }
 
-            if (currentDirection == Direction::UP && exitStepCounter == 0) {
-                exitStepCounter = 1;
+            if (getCurrentDirection() == Direction::UP && exitTimer == 0.0f) {
+                exitTimer = deltaTime; // Marks the UP leg as done
             }
         }
 
-        switch (currentDirection) {
+        switch (getCurrentDirection()) {
         case Direction::LEFT:
             newX -= moveDistance;
             break;
@@ -198,10 +201,11 @@ void GhostModel::update(float deltaTime) {
         return;
     }
 
-    if (state == GhostState::CHASING || state == GhostState::FEAR) {
-        float moveDistance = speed * deltaTime;
-        float newX = x;
-        float newY = y;
+    if (getState() == GhostState::CHASING || getState() == GhostState::FEAR) {
+        Direction currentDirection = getCurrentDirection();
+        float moveDistance = getSpeed() * deltaTime;
+        float newX = getX();
+        float newY = getY();
 
         switch (currentDirection) {
         case Direction::LEFT:
@@ -244,9 +248,9 @@ void GhostModel::setCellDimensions(float cellW, float cellH) {
     cellHeight = cellH;
 }
 
-void GhostModel::setDirection(Direction dir) { currentDirection = dir; }
+void GhostModel::setDirection(Direction dir) { setCurrentDirection(dir); }
 
-void GhostModel::stopMovement() { currentDirection = Direction::NONE; }
+void GhostModel::stopMovement() { setCurrentDirection(Direction::NONE); }
 
 Direction GhostModel::getReverseDirection(Direction dir) const {
     switch (dir) {
@@ -264,54 +268,72 @@ Direction GhostModel::getReverseDirection(Direction dir) const {
     return Direction::NONE;
 }
 
-bool GhostModel::needsDirectionDecision(const std::vector<Direction>& viableDirections) const {
-    Direction reverse = getReverseDirection(currentDirection);
+bool GhostModel::needsDirectionDecision(DirectionMask viableDirections) const {
+    // No 180° turns - reverse never counts as an option
+    DirectionMask options = viableDirections & ~directionBit(getReverseDirection(getCurrentDirection()));
+
+    int optionCount = directionCount(options);
+    bool currentStillViable = (options & directionBit(getCurrentDirection())) != 0;
 
-    int optionCount = 0;
-    bool currentStillViable = false;
+    return (optionCount >= 2) || (!currentStillViable && optionCount > 0);
+}
+
+Direction GhostModel::chooseByPathDistance(DirectionMask options, const DirectionDistances& distances,
+                                           bool flee) const {
+    Direction bestDirection = Direction::NONE;
+    int bestDistance = 0;
 
-    for (Direction dir : viableDirections) {
-        if (dir == reverse)
+    for (int i = 0; i < 4; i++) {
+        Direction dir = MOVE_DIRECTIONS[i];
+        if (!(options & directionBit(dir)) || distances[i] == DistanceField::UNREACHABLE) {
             continue;
-        optionCount++;
-        if (dir == currentDirection) {
-            currentStillViable = true;
         }
-    }
 
-    return (optionCount >= 2) || (!currentStillViable && optionCount > 0);
+        int distance = distances[i];
+        bool better = flee ? distance > bestDistance : distance < bestDistance;
+        if (bestDirection == Direction::NONE || better || (distance == bestDistance && dir == getCurrentDirection())) {
+            bestDistance = distance;
+            bestDirection = dir;
+        }
+    }
+    return bestDirection;
 }
 
-void GhostModel::makeDirectionDecision(const std::vector<Direction>& viableDirections, float targetX, float targetY,
-                                       Direction pacmanDirection) {
-    if (viableDirections.empty()) {
-        currentDirection = Direction::NONE;
+void GhostModel::makeDirectionDecision(DirectionMask viableDirections, const DirectionDistances& pathDistances,
+                                       float targetX, float targetY, Direction pacmanDirection) {
+    if (viableDirections == 0) {
+        setCurrentDirection(Direction::NONE);
         return;
     }
 
-    Direction reverse = getReverseDirection(currentDirection);
+    Direction reverse = getReverseDirection(getCurrentDirection());
 
     // No 180° turns - prevents ping-ponging behavior
-    std::vector<Direction> validOptions;
-    for (Direction dir : viableDirections) {
-        if (dir != reverse) {
-            validOptions.push_back(dir);
-        }
-    }
+    DirectionMask validOptions = viableDirections & ~directionBit(reverse);
 
-    if (validOptions.empty()) {
-        currentDirection = Direction::NONE;
+    if (validOptions == 0) {
+        setCurrentDirection(Direction::NONE);
         return;
     }
 
-    // FEAR MODE: Maximize distance from PacMan (flee behavior)
-    if (state == GhostState::FEAR) {
+    // FEAR MODE: Maximize path distance from PacMan (flee behavior)
+    if (getState() == GhostState::FEAR) {
+        Direction pathDirection = chooseByPathDistance(validOptions, pathDistances, true);
+        if (pathDirection != Direction::NONE) {
+            setCurrentDirection(pathDirection);
+            return;
+        }
+
+        // PacMan unreachable (e.g. ghost still behind the door): straight-line distance
         Direction bestDirection = Direction::NONE;
         float maxDistance = -1.0f;
 
-        for (Direction dir : validOptions) {
-            float testX = x;
-            float testY = y;
+        for (Direction dir : MOVE_DIRECTIONS) {
+            if (!(validOptions & directionBit(dir)))
+                continue;
+
+            float testX = getX();
+            float testY = getY();
 
             switch (dir) {
             case Direction::LEFT:
@@ -336,40 +358,51 @@ void GhostModel::makeDirectionDecision(const std::vector<Direction>& viableDirec
             const float EPSILON = 0.01f;
             bool isTie = std::abs(distance - maxDistance) < EPSILON;
 
-            if (distance > maxDistance || (isTie && dir == currentDirection)) {
+            if (distance > maxDistance || (isTie && dir == getCurrentDirection())) {
                 maxDistance = distance;
                 bestDirection = dir;
             }
         }
 
-        currentDirection = bestDirection;
+        setCurrentDirection(bestDirection);
         return;
     }
 
     // RED: 50% keep direction, 50% random (unpredictable movement)
     if (type == GhostType::RED) {
-        float roll = Random::getInstance().getFloat(0.0f, 1.0f);
+        float roll = random.getFloat(0.0f, 1.0f);
 
-        if (roll < 0.5f) {
-            auto it = std::find(validOptions.begin(), validOptions.end(), currentDirection);
-            if (it != validOptions.end()) {
-                return;
-            }
+        if (roll < 0.5f && (validOptions & directionBit(getCurrentDirection()))) {
+            return;
         }
 
-        int randomIndex = Random::getInstance().getInt(0, static_cast<int>(validOptions.size()) - 1);
-        currentDirection = validOptions[randomIndex];
+        int randomIndex = random.getInt(0, directionCount(validOptions) - 1);
+        for (Direction dir : MOVE_DIRECTIONS) {
+            if ((validOptions & directionBit(dir)) && randomIndex-- == 0) {
+                setCurrentDirection(dir);
+                break;
+            }
+        }
         return;
     }
 
-    // ORANGE: Direct chase (minimize distance to current PacMan position)
+    // ORANGE: Direct chase (minimize path distance to current PacMan position)
     if (type == GhostType::ORANGE) {
+        Direction pathDirection = chooseByPathDistance(validOptions, pathDistances, false);
+        if (pathDirection != Direction::NONE) {
+            setCurrentDirection(pathDirection);
+            return;
+        }
+
         Direction bestDirection = Direction::NONE;
         float minDistance = 999999.0f;
 
-        for (Direction dir : validOptions) {
-            float testX = x;
-            float testY = y;
+        for (Direction dir : MOVE_DIRECTIONS) {
+            if (!(validOptions & directionBit(dir)))
+                continue;
+
+            float testX = getX();
+            float testY = getY();
 
             switch (dir) {
             case Direction::LEFT:
@@ -393,18 +426,24 @@ void GhostModel::makeDirectionDecision(const std::vector<Direction>& viableDirec
             const float EPSILON = 0.01f;
             bool isTie = std::abs(distance - minDistance) < EPSILON;
 
-            if (distance < minDistance || (isTie && dir == currentDirection)) {
+            if (distance < minDistance || (isTie && dir == getCurrentDirection())) {
                 minDistance = distance;
                 bestDirection = dir;
             }
         }
 
-        currentDirection = bestDirection;
+        setCurrentDirection(bestDirection);
         return;
     }
 
     // PINK: Predictive chase (target 4 tiles ahead of PacMan)
     if (type == GhostType::PINK) {
+        Direction pathDirection = chooseByPathDistance(validOptions, pathDistances, false);
+        if (pathDirection != Direction::NONE) {
+            setCurrentDirection(pathDirection);
+            return;
+        }
+
         float predictedX = targetX;
         float predictedY = targetY;
 
@@ -428,9 +467,12 @@ void GhostModel::makeDirectionDecision(const std::vector<Direction>& viableDirec
         Direction bestDirection = Direction::NONE;
         float minDistance = 999999.0f;
 
-        for (Direction dir : validOptions) {
-            float testX = x;
-            float testY = y;
+        for (Direction dir : MOVE_DIRECTIONS) {
+            if (!(validOptions & directionBit(dir)))
+                continue;
+
+            float testX = getX();
+            float testY = getY();
 
             switch (dir) {
             case Direction::LEFT:
@@ -455,18 +497,24 @@ void GhostModel::makeDirectionDecision(const std::vector<Direction>& viableDirec
             const float EPSILON = 0.01f;
             bool isTie = std::abs(distance - minDistance) < EPSILON;
 
-            if (distance < minDistance || (isTie && dir == currentDirection)) {
+            if (distance < minDistance || (isTie && dir == getCurrentDirection())) {
                 minDistance = distance;
                 bestDirection = dir;
             }
         }
 
-        currentDirection = bestDirection;
+        setCurrentDirection(bestDirection);
         return;
     }
 
     // BLUE: Same predictive behavior as PINK
     if (type == GhostType::BLUE) {
+        Direction pathDirection = chooseByPathDistance(validOptions, pathDistances, false);
+        if (pathDirection != Direction::NONE) {
+            setCurrentDirection(pathDirection);
+            return;
+        }
+
         float predictedX = targetX;
         float predictedY = targetY;
 
@@ -490,9 +538,12 @@ void GhostModel::makeDirectionDecision(const std::vector<Direction>& viableDirec
         Direction bestDirection = Direction::NONE;
         float minDistance = 999999.0f;
 
-        for (Direction dir : validOptions) {
-            float testX = x;
-            float testY = y;
+        for (Direction dir : MOVE_DIRECTIONS) {
+            if (!(validOptions & directionBit(dir)))
+                continue;
+
+            float testX = getX();
+            float testY = getY();
 
             switch (dir) {
             case Direction::LEFT:
@@ -516,37 +567,39 @@ void GhostModel::makeDirectionDecision(const std::vector<Direction>& viableDirec
             const float EPSILON = 0.01f;
             bool isTie = std::abs(distance - minDistance) < EPSILON;
 
-            if (distance < minDistance || (isTie && dir == currentDirection)) {
+            if (distance < minDistance || (isTie && dir == getCurrentDirection())) {
                 minDistance = distance;
                 bestDirection = dir;
             }
         }
 
-        currentDirection = bestDirection;
+        setCurrentDirection(bestDirection);
         return;
     }
 }
 
 void GhostModel::enterFearMode() {
-    if (state == GhostState::CHASING) {
-        state = GhostState::FEAR;
-        speed = 0.25f;
-        currentDirection = getReverseDirection(currentDirection);
+    if (getState() == GhostState::CHASING) {
+        setState(GhostState::FEAR);
+        setCurrentSpeed(0.25f);
+        setCurrentDirection(getReverseDirection(getCurrentDirection()));
+        decisionNode = -1; // Reversed: the node just decided at is ahead again
     }
 }
 
 void GhostModel::exitFearMode() {
-    if (state == GhostState::FEAR || state == GhostState::EATEN) {
-        state = GhostState::CHASING;
-        speed = targetSpeed;
+    if (getState() == GhostState::FEAR || getState() == GhostState::EATEN) {
+        setState(GhostState::CHASING);
+        setCurrentSpeed(targetSpeed);
     }
 }
 
 void GhostModel::getEaten() {
     // Eyes navigate back to spawn (no teleport)
-    state = GhostState::EATEN;
-    speed = 1.0f;
+    setState(GhostState::EATEN);
+    setCurrentSpeed(1.0f);
     hasExitedSpawn = false; // Can pass through door
+    decisionNode = -1;
 }
 
 void GhostModel::setEatenRespawnPosition(float x, float y) {
@@ -554,26 +607,73 @@ void GhostModel::setEatenRespawnPosition(float x, float y) {
     eatenRespawnY = y;
 }
 
+void GhostModel::arriveAtSpawn() {
+    setPosition(eatenRespawnX, eatenRespawnY);
+    setState(GhostState::RESPAWNING);
+    respawnFlickerTimer = 0.0f;
+    respawnFlickerCount = 0;
+}
+
 void GhostModel::startExitingSpawn() {
-    state = GhostState::EXITING_SPAWN;
-    speed = targetSpeed;
-    currentDirection = Direction::NONE;
-    exitStepCounter = 0;
+    setState(GhostState::EXITING_SPAWN);
+    setCurrentSpeed(targetSpeed);
+    setCurrentDirection(Direction::NONE);
+    exitTimer = 0.0f;
     hasExitedSpawn = false;
+    decisionNode = -1;
 }
 
 void GhostModel::resetToSpawn(float delay) {
-    state = GhostState::SPAWNING;
+    setState(GhostState::SPAWNING);
     spawnTimer = 0.0f;
     spawnDelay = delay;
-    speed = targetSpeed;
-    currentDirection = Direction::NONE;
-    exitStepCounter = 0;
+    setCurrentSpeed(targetSpeed);
+    setCurrentDirection(Direction::NONE);
+    exitTimer = 0.0f;
     hasExitedSpawn = false;
+    decisionNode = -1;
 }
 
 void GhostModel::setSpeed(float newSpeed) {
-    speed = newSpeed;
+    setCurrentSpeed(newSpeed);
     targetSpeed = newSpeed;
 }
+GhostModel::Snapshot GhostModel::snapshot() const {
+    return {getX(),
+            getY(),
+            getState(),
+            spawnDelay,
+            spawnTimer,
+            getSpeed(),
+            targetSpeed,
+            getCurrentDirection(),
+            hasExitedSpawn,
+            eatenRespawnX,
+            eatenRespawnY,
+            exitTimer,
+            fearTimer,
+            respawnFlickerTimer,
+            respawnFlickerCount,
+            decisionNode,
+            random.getState()};
+}
+
+void GhostModel::restore(const Snapshot& snapshot) {
+    teleport(snapshot.x, snapshot.y);
+    setState(snapshot.state);
+    spawnDelay = snapshot.spawnDelay;
+    spawnTimer = snapshot.spawnTimer;
+    setCurrentSpeed(snapshot.speed);
+    targetSpeed = snapshot.targetSpeed;
+    setCurrentDirection(snapshot.currentDirection);
+    hasExitedSpawn = snapshot.hasExitedSpawn;
+    eatenRespawnX = snapshot.eatenRespawnX;
+    eatenRespawnY = snapshot.eatenRespawnY;
+    exitTimer = snapshot.exitTimer;
+    fearTimer = snapshot.fearTimer;
+    respawnFlickerTimer = snapshot.respawnFlickerTimer;
+    respawnFlickerCount = snapshot.respawnFlickerCount;
+    decisionNode = snapshot.decisionNode;
+    random.setState(snapshot.random);
+}
 } // namespace logic
\ No newline at end of file
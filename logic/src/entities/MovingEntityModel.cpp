@@ -0,0 +1,12 @@
+#include "logic/entities/MovingEntityModel.h"
+
+namespace logic {
+MovingEntityModel::MovingEntityModel(MovingEntityStore& store, float x, float y, float width, float height,
+                                     float speed)
+    : store(&store), slot(store.add(x, y, width, height, speed)) {}
+
+void MovingEntityModel::teleport(float newX, float newY) {
+    setPosition(newX, newY);
+    storePreviousPosition();
+}
+} // namespace logic
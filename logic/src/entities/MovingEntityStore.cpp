@@ -0,0 +1,46 @@
+#include "logic/entities/MovingEntityStore.h"
+#include <algorithm>
+
+namespace logic {
+size_t MovingEntityStore::add(float x, float y, float width, float height, float speed) {
+    xs.push_back(x);
+    ys.push_back(y);
+    previousXs.push_back(x);
+    previousYs.push_back(y);
+    widths.push_back(width);
+    heights.push_back(height);
+    speeds.push_back(speed);
+    directions.push_back(Direction::NONE);
+    states.push_back(0);
+    return xs.size() - 1;
+}
+
+void MovingEntityStore::reserve(size_t count) {
+    xs.reserve(count);
+    ys.reserve(count);
+    previousXs.reserve(count);
+    previousYs.reserve(count);
+    widths.reserve(count);
+    heights.reserve(count);
+    speeds.reserve(count);
+    directions.reserve(count);
+    states.reserve(count);
+}
+
+void MovingEntityStore::clear() {
+    xs.clear();
+    ys.clear();
+    previousXs.clear();
+    previousYs.clear();
+    widths.clear();
+    heights.clear();
+    speeds.clear();
+    directions.clear();
+    states.clear();
+}
+
+void MovingEntityStore::storePreviousPositions() {
+    std::copy(xs.begin(), xs.end(), previousXs.begin());
+    std::copy(ys.begin(), ys.end(), previousYs.begin());
+}
+} // namespace logic
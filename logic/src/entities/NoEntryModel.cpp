@@ -1,7 +1,7 @@
 #include "logic/entities/NoEntryModel.h"
 
 namespace logic {
-NoEntryModel::NoEntryModel(float x, float y, float width, float height) : EntityModel(x, y, width, height) {
+NoEntryModel::NoEntryModel(float x, float y, float width, float height) : StaticEntityModel(x, y, width, height) {
     blockedGhostTypes.insert(GhostType::RED);
     blockedGhostTypes.insert(GhostType::PINK);
     blockedGhostTypes.insert(GhostType::BLUE);
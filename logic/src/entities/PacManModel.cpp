@@ -2,14 +2,15 @@
 #include <cmath>
 
 namespace logic {
-PacManModel::PacManModel(float x, float y, float width, float height, float speed)
-    : EntityModel(x, y, width, height), speed(speed), lives(3), currentDirection(Direction::NONE),
-      nextDirection(Direction::NONE), cellWidth(0.0f), cellHeight(0.0f), isDying(false), deathTimer(0.0f) {}
+PacManModel::PacManModel(MovingEntityStore& store, float x, float y, float width, float height, float speed)
+    : MovingEntityModel(store, x, y, width, height, speed), lives(3), nextDirection(Direction::NONE), cellWidth(0.0f),
+      cellHeight(0.0f), isDying(false), deathTimer(0.0f) {}
 
 void PacManModel::update(float deltaTime) {
-    float moveDistance = speed * deltaTime;
-    float newX = x;
-    float newY = y;
+    Direction currentDirection = getCurrentDirection();
+    float moveDistance = getSpeed() * deltaTime;
+    float newX = getX();
+    float newY = getY();
 
     switch (currentDirection) {
     case Direction::LEFT:
@@ -49,25 +50,21 @@ int PacManModel::getLives() const { return lives; }
 
 void PacManModel::loseLife() { lives--; }
 
-float PacManModel::getSpeed() const { return speed; }
-
-Direction PacManModel::getCurrentDirection() const { return currentDirection; }
-
 Direction PacManModel::getNextDirection() const { return nextDirection; }
 
-void PacManModel::setSpeed(float newSpeed) { speed = newSpeed; }
+void PacManModel::setSpeed(float newSpeed) { setCurrentSpeed(newSpeed); }
 
 void PacManModel::setNextDirection(Direction direction) { nextDirection = direction; }
 
 void PacManModel::applyNextDirection() {
     if (nextDirection != Direction::NONE) {
-        currentDirection = nextDirection;
+        setCurrentDirection(nextDirection);
         nextDirection = Direction::NONE;
     }
 }
 
 void PacManModel::stopMovement() {
-    currentDirection = Direction::NONE;
+    setCurrentDirection(Direction::NONE);
     nextDirection = Direction::NONE;
 }
 
@@ -79,7 +76,7 @@ void PacManModel::setCellDimensions(float cellW, float cellH) {
 void PacManModel::startDeath() {
     isDying = true;
     deathTimer = 0.0f;
-    currentDirection = Direction::NONE;
+    setCurrentDirection(Direction::NONE);
     nextDirection = Direction::NONE;
 }
 
@@ -99,10 +96,23 @@ void PacManModel::updateDeath(float deltaTime) {
 }
 
 void PacManModel::respawn(float spawnX, float spawnY) {
-    setPosition(spawnX, spawnY);
+    teleport(spawnX, spawnY);
     isDying = false;
     deathTimer = 0.0f;
-    currentDirection = Direction::NONE;
+    setCurrentDirection(Direction::NONE);
     nextDirection = Direction::NONE;
 }
+PacManModel::Snapshot PacManModel::snapshot() const {
+    return {getX(), getY(), getSpeed(), lives, getCurrentDirection(), nextDirection, isDying, deathTimer};
+}
+
+void PacManModel::restore(const Snapshot& snapshot) {
+    teleport(snapshot.x, snapshot.y);
+    setCurrentSpeed(snapshot.speed);
+    lives = snapshot.lives;
+    setCurrentDirection(snapshot.currentDirection);
+    nextDirection = snapshot.nextDirection;
+    isDying = snapshot.isDying;
+    deathTimer = snapshot.deathTimer;
+}
 } // namespace logic
\ No newline at end of file
@@ -0,0 +1,6 @@
+#include "logic/entities/StaticEntityModel.h"
+
+namespace logic {
+StaticEntityModel::StaticEntityModel(float x, float y, float width, float height)
+    : x(x), y(y), width(width), height(height) {}
+} // namespace logic
@@ -1,7 +1,7 @@
 #include "logic/entities/WallModel.h"
 
 namespace logic {
-WallModel::WallModel(float x, float y, float width, float height) : EntityModel(x, y, width, height) {}
+WallModel::WallModel(float x, float y, float width, float height) : StaticEntityModel(x, y, width, height) {}
 
 void WallModel::update(float /*deltaTime*/) {}
 } // namespace logic
\ No newline at end of file
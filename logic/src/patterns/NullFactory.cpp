@@ -0,0 +1,39 @@
+#include "logic/patterns/NullFactory.h"
+#include "logic/entities/CoinModel.h"
+#include "logic/entities/DoorModel.h"
+#include "logic/entities/FruitModel.h"
+#include "logic/entities/NoEntryModel.h"
+#include "logic/entities/PacManModel.h"
+#include "logic/entities/WallModel.h"
+
+namespace logic {
+EntityCreationResult NullFactory::createWall(LevelArena& arena, float x, float y, float w, float h) {
+    return {arena.makeShared<WallModel>(x, y, w, h), nullptr};
+}
+
+EntityCreationResult NullFactory::createPacMan(LevelArena& arena, MovingEntityStore& store, float x, float y, float w,
+                                               float h, float speed) {
+    return {arena.makeShared<PacManModel>(store, x, y, w, h, speed), nullptr};
+}
+
+EntityCreationResult NullFactory::createCoin(LevelArena& arena, float x, float y, float w, float h) {
+    return {arena.makeShared<CoinModel>(x, y, w, h), nullptr};
+}
+
+EntityCreationResult NullFactory::createGhost(LevelArena& arena, MovingEntityStore& store, float x, float y, float w,
+                                              float h, GhostType type, float spawnDelay) {
+    return {arena.makeShared<GhostModel>(store, x, y, w, h, type, spawnDelay), nullptr};
+}
+
+EntityCreationResult NullFactory::createDoor(LevelArena& arena, float x, float y, float w, float h) {
+    return {arena.makeShared<DoorModel>(x, y, w, h), nullptr};
+}
+
+EntityCreationResult NullFactory::createNoEntry(LevelArena& arena, float x, float y, float w, float h) {
+    return {arena.makeShared<NoEntryModel>(x, y, w, h), nullptr};
+}
+
+EntityCreationResult NullFactory::createFruit(LevelArena& arena, float x, float y, float w, float h) {
+    return {arena.makeShared<FruitModel>(x, y, w, h), nullptr};
+}
+} // namespace logic
@@ -0,0 +1,129 @@
+#include "logic/replay/Replay.h"
+#include "logic/utils/ByteStream.h"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+namespace logic {
+namespace {
+const char FILE_MAGIC[4] = {'P', 'M', 'R', 'P'};
+const uint64_t FILE_VERSION = 4;
+
+const int ACTION_BITS = 3;
+const uint64_t ACTION_MASK = (1u << ACTION_BITS) - 1;
+const uint64_t ACTION_COUNT = static_cast<uint64_t>(InputAction::LEVEL_CHEAT) + 1;
+} // namespace
+
+InputAction inputActionFor(Direction direction) {
+    switch (direction) {
+    case Direction::DOWN:
+        return InputAction::DOWN;
+    case Direction::LEFT:
+        return InputAction::LEFT;
+    case Direction::RIGHT:
+        return InputAction::RIGHT;
+    case Direction::UP:
+    case Direction::NONE:
+        break;
+    }
+    return InputAction::UP;
+}
+
+const Keyframe* Replay::findKeyframe(uint32_t tick) const {
+    auto it = std::upper_bound(keyframes.begin(), keyframes.end(), tick,
+                               [](uint32_t value, const Keyframe& keyframe) { return value < keyframe.tick; });
+    return it == keyframes.begin() ? nullptr : &*(it - 1);
+}
+
+size_t Replay::findInput(uint32_t tick) const {
+    auto it = std::lower_bound(inputs.begin(), inputs.end(), tick,
+                               [](const InputEvent& input, uint32_t value) { return input.tick < value; });
+    return static_cast<size_t>(it - inputs.begin());
+}
+
+void Replay::save(const std::string& filename) const {
+    std::vector<uint8_t> buffer;
+    ByteWriter writer(buffer);
+
+    writer.writeBytes(reinterpret_cast<const uint8_t*>(FILE_MAGIC), sizeof(FILE_MAGIC));
+    writer.writeVarint(FILE_VERSION);
+    writer.writeString(mapFile);
+    writer.writeFixed64(seed);
+    writer.writeFloat(tickDuration);
+    writer.writeVarint(tickCount);
+    writer.writeFixed64(finalChecksum);
+    writer.writeVarint(keyframeInterval);
+
+    // Delta ticks: long idle stretches cost as much as a single byte
+    writer.writeVarint(inputs.size());
+    uint32_t previousTick = 0;
+    for (const auto& input : inputs) {
+        writer.writeVarint(static_cast<uint64_t>(input.tick - previousTick) << ACTION_BITS |
+                           static_cast<uint64_t>(input.action));
+        previousTick = input.tick;
+    }
+
+    writer.writeVarint(keyframes.size());
+    previousTick = 0;
+    for (const auto& keyframe : keyframes) {
+        writer.writeVarint(keyframe.tick - previousTick);
+        writer.writeVarint(keyframe.state.size());
+        writer.writeBytes(keyframe.state.data(), keyframe.state.size());
+        previousTick = keyframe.tick;
+    }
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("ERROR: Cannot write replay file: " + filename);
+    }
+    file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+}
+
+Replay Replay::load(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("ERROR: Cannot open replay file: " + filename);
+    }
+    std::vector<uint8_t> buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    ByteReader reader(buffer.data(), buffer.size());
+    const uint8_t* magic = reader.readBytes(sizeof(FILE_MAGIC));
+    if (!std::equal(magic, magic + sizeof(FILE_MAGIC), FILE_MAGIC) || reader.readVarint() != FILE_VERSION) {
+        throw std::runtime_error("ERROR: Not a replay file (or unsupported version): " + filename);
+    }
+
+    Replay replay;
+    replay.mapFile = reader.readString();
+    replay.seed = reader.readFixed64();
+    replay.tickDuration = reader.readFloat();
+    replay.tickCount = static_cast<uint32_t>(reader.readVarint());
+    replay.finalChecksum = reader.readFixed64();
+    replay.keyframeInterval = static_cast<uint32_t>(reader.readVarint());
+
+    uint64_t inputCount = reader.readVarint();
+    uint32_t tick = 0;
+    for (uint64_t i = 0; i < inputCount; i++) {
+        uint64_t value = reader.readVarint();
+        if ((value & ACTION_MASK) >= ACTION_COUNT) {
+            throw std::runtime_error("ERROR: Unknown input in replay file: " + filename);
+        }
+        tick += static_cast<uint32_t>(value >> ACTION_BITS);
+        replay.inputs.push_back({tick, static_cast<InputAction>(value & ACTION_MASK)});
+    }
+
+    uint64_t keyframeCount = reader.readVarint();
+    tick = 0;
+    for (uint64_t i = 0; i < keyframeCount; i++) {
+        tick += static_cast<uint32_t>(reader.readVarint());
+        size_t size = static_cast<size_t>(reader.readVarint());
+        const uint8_t* state = reader.readBytes(size);
+        replay.keyframes.push_back({tick, std::vector<uint8_t>(state, state + size)});
+    }
+
+    if (replay.mapFile.empty() || replay.tickDuration <= 0.0f) {
+        throw std::runtime_error("ERROR: Replay file missing map or tick duration: " + filename);
+    }
+    return replay;
+}
+} // namespace logic
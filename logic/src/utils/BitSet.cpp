@@ -0,0 +1,24 @@
+#include "logic/utils/BitSet.h"
+#include <algorithm>
+#include <bitset>
+
+namespace logic {
+BitSet::BitSet() : bitCount(0) {}
+
+void BitSet::resize(size_t newBitCount) {
+    bitCount = newBitCount;
+    words.assign((bitCount + 63) / 64, 0);
+}
+
+void BitSet::assignWords(const uint64_t* source) { std::copy(source, source + words.size(), words.begin()); }
+
+void BitSet::clearAll() { std::fill(words.begin(), words.end(), 0); }
+
+size_t BitSet::count() const {
+    size_t total = 0;
+    for (uint64_t word : words) {
+        total += std::bitset<64>(word).count(); // Compiles to popcnt where available
+    }
+    return total;
+}
+} // namespace logic
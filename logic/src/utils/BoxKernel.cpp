@@ -0,0 +1,146 @@
+#include "logic/utils/BoxKernel.h"
+#include "logic/entities/EntityModel.h"
+#include <algorithm>
+#include <bitset>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define PACMAN_BOX_KERNEL_AVX
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define PACMAN_BOX_KERNEL_SSE2
+#endif
+
+namespace logic {
+namespace {
+size_t wordCount(size_t count) { return (count + 63) / 64; }
+
+size_t countHits(const uint64_t* hits, size_t count) {
+    size_t total = 0;
+    for (size_t word = 0; word < wordCount(count); word++) {
+        total += std::bitset<64>(hits[word]).count();
+    }
+    return total;
+}
+
+/**
+ * Scalar tests for boxes [begin, count), ORed into already cleared hit words.
+ */
+void intersectRange(float x, float y, float width, float height, const BoxColumns& boxes, size_t begin,
+                    uint64_t* hits) {
+    for (size_t i = begin; i < boxes.count; i++) {
+        if (boxesIntersect(x, y, width, height, boxes.xs[i], boxes.ys[i], boxes.widths[i], boxes.heights[i])) {
+            hits[i >> 6] |= uint64_t(1) << (i & 63);
+        }
+    }
+}
+} // namespace
+
+size_t intersectBoxesScalar(float x, float y, float width, float height, const BoxColumns& boxes, uint64_t* hits) {
+    std::fill(hits, hits + wordCount(boxes.count), 0);
+    intersectRange(x, y, width, height, boxes, 0, hits);
+    return countHits(hits, boxes.count);
+}
+
+// Lane edges are computed like boxesIntersect: size * 0.5f is the same correctly rounded value as size / 2.0f.
+// Overlap is written as "not less / not greater" (unordered compares) so NaN lanes hit exactly like the
+// scalar !(a < b || ...) does. Lane bits collect in a register and are stored once per 64 boxes.
+
+#if defined(PACMAN_BOX_KERNEL_AVX)
+size_t intersectBoxes(float x, float y, float width, float height, const BoxColumns& boxes, uint64_t* hits) {
+    std::fill(hits, hits + wordCount(boxes.count), 0);
+
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 left1 = _mm256_set1_ps(x - width / 2.0f);
+    const __m256 right1 = _mm256_set1_ps(x + width / 2.0f);
+    const __m256 top1 = _mm256_set1_ps(y - height / 2.0f);
+    const __m256 bottom1 = _mm256_set1_ps(y + height / 2.0f);
+
+    const float* xs = boxes.xs;
+    const float* ys = boxes.ys;
+    const float* widths = boxes.widths;
+    const float* heights = boxes.heights;
+
+    uint64_t word = 0;
+    size_t i = 0;
+    for (; i + 8 <= boxes.count; i += 8) {
+        __m256 centerX = _mm256_loadu_ps(xs + i);
+        __m256 centerY = _mm256_loadu_ps(ys + i);
+        __m256 halfWidth = _mm256_mul_ps(_mm256_loadu_ps(widths + i), half);
+        __m256 halfHeight = _mm256_mul_ps(_mm256_loadu_ps(heights + i), half);
+
+        __m256 overlapX = _mm256_and_ps(_mm256_cmp_ps(right1, _mm256_sub_ps(centerX, halfWidth), _CMP_NLT_UQ),
+                                        _mm256_cmp_ps(left1, _mm256_add_ps(centerX, halfWidth), _CMP_NGT_UQ));
+        __m256 overlapY = _mm256_and_ps(_mm256_cmp_ps(bottom1, _mm256_sub_ps(centerY, halfHeight), _CMP_NLT_UQ),
+                                        _mm256_cmp_ps(top1, _mm256_add_ps(centerY, halfHeight), _CMP_NGT_UQ));
+
+        // 8 lanes never straddle a hit word (i is a multiple of 8)
+        auto lanes = static_cast<uint64_t>(_mm256_movemask_ps(_mm256_and_ps(overlapX, overlapY)));
+        word |= lanes << (i & 63);
+        if ((i & 63) == 56) {
+            hits[i >> 6] = word;
+            word = 0;
+        }
+    }
+    if (i & 63) {
+        hits[i >> 6] = word;
+    }
+
+    intersectRange(x, y, width, height, boxes, i, hits);
+    return countHits(hits, boxes.count);
+}
+
+const char* boxKernelName() { return "avx"; }
+#elif defined(PACMAN_BOX_KERNEL_SSE2)
+size_t intersectBoxes(float x, float y, float width, float height, const BoxColumns& boxes, uint64_t* hits) {
+    std::fill(hits, hits + wordCount(boxes.count), 0);
+
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 left1 = _mm_set1_ps(x - width / 2.0f);
+    const __m128 right1 = _mm_set1_ps(x + width / 2.0f);
+    const __m128 top1 = _mm_set1_ps(y - height / 2.0f);
+    const __m128 bottom1 = _mm_set1_ps(y + height / 2.0f);
+
+    const float* xs = boxes.xs;
+    const float* ys = boxes.ys;
+    const float* widths = boxes.widths;
+    const float* heights = boxes.heights;
+
+    uint64_t word = 0;
+    size_t i = 0;
+    for (; i + 4 <= boxes.count; i += 4) {
+        __m128 centerX = _mm_loadu_ps(xs + i);
+        __m128 centerY = _mm_loadu_ps(ys + i);
+        __m128 halfWidth = _mm_mul_ps(_mm_loadu_ps(widths + i), half);
+        __m128 halfHeight = _mm_mul_ps(_mm_loadu_ps(heights + i), half);
+
+        __m128 overlapX = _mm_and_ps(_mm_cmpnlt_ps(right1, _mm_sub_ps(centerX, halfWidth)),
+                                     _mm_cmpngt_ps(left1, _mm_add_ps(centerX, halfWidth)));
+        __m128 overlapY = _mm_and_ps(_mm_cmpnlt_ps(bottom1, _mm_sub_ps(centerY, halfHeight)),
+                                     _mm_cmpngt_ps(top1, _mm_add_ps(centerY, halfHeight)));
+
+        // 4 lanes never straddle a hit word (i is a multiple of 4)
+        auto lanes = static_cast<uint64_t>(_mm_movemask_ps(_mm_and_ps(overlapX, overlapY)));
+        word |= lanes << (i & 63);
+        if ((i & 63) == 60) {
+            hits[i >> 6] = word;
+            word = 0;
+        }
+    }
+    if (i & 63) {
+        hits[i >> 6] = word;
+    }
+
+    intersectRange(x, y, width, height, boxes, i, hits);
+    return countHits(hits, boxes.count);
+}
+
+const char* boxKernelName() { return "sse2"; }
+#else
+size_t intersectBoxes(float x, float y, float width, float height, const BoxColumns& boxes, uint64_t* hits) {
+    return intersectBoxesScalar(x, y, width, height, boxes, hits);
+}
+
+const char* boxKernelName() { return "scalar"; }
+#endif
+} // namespace logic
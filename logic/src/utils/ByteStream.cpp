@@ -0,0 +1,101 @@
+#include "logic/utils/ByteStream.h"
+#include <cstring>
+#include <stdexcept>
+
+namespace logic {
+void ByteWriter::writeVarint(uint64_t value) {
+    while (value >= 0x80) {
+        buffer.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<uint8_t>(value));
+}
+
+void ByteWriter::writeSignedVarint(int64_t value) {
+    // Zigzag: 0, -1, 1, -2, ... → 0, 1, 2, 3, ...
+    writeVarint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+void ByteWriter::writeFloat(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (int i = 0; i < 4; i++) {
+        buffer.push_back(static_cast<uint8_t>(bits >> (i * 8)));
+    }
+}
+
+void ByteWriter::writeFixed64(uint64_t value) {
+    for (int i = 0; i < 8; i++) {
+        buffer.push_back(static_cast<uint8_t>(value >> (i * 8)));
+    }
+}
+
+void ByteWriter::writeString(const std::string& value) {
+    writeVarint(value.size());
+    buffer.insert(buffer.end(), value.begin(), value.end());
+}
+
+void ByteWriter::writeBytes(const uint8_t* bytes, size_t count) { buffer.insert(buffer.end(), bytes, bytes + count); }
+
+void ByteReader::require(size_t count) const {
+    if (count > size - position) {
+        throw std::runtime_error("ERROR: Unexpected end of binary data");
+    }
+}
+
+uint8_t ByteReader::readByte() {
+    require(1);
+    return data[position++];
+}
+
+uint64_t ByteReader::readVarint() {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        uint8_t byte = readByte();
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return value;
+        }
+    }
+    throw std::runtime_error("ERROR: Malformed varint in binary data");
+}
+
+int64_t ByteReader::readSignedVarint() {
+    uint64_t value = readVarint();
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+float ByteReader::readFloat() {
+    require(4);
+    uint32_t bits = 0;
+    for (int i = 0; i < 4; i++) {
+        bits |= static_cast<uint32_t>(data[position++]) << (i * 8);
+    }
+
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+uint64_t ByteReader::readFixed64() {
+    require(8);
+    uint64_t value = 0;
+    for (int i = 0; i < 8; i++) {
+        value |= static_cast<uint64_t>(data[position++]) << (i * 8);
+    }
+    return value;
+}
+
+std::string ByteReader::readString() {
+    size_t length = static_cast<size_t>(readVarint());
+    const uint8_t* bytes = readBytes(length);
+    return std::string(reinterpret_cast<const char*>(bytes), length);
+}
+
+const uint8_t* ByteReader::readBytes(size_t count) {
+    require(count);
+    const uint8_t* bytes = data + position;
+    position += count;
+    return bytes;
+}
+} // namespace logic
@@ -0,0 +1,12 @@
+#include "logic/utils/LevelArena.h"
+
+namespace logic {
+namespace {
+// First chunk: the shipped map's models fit; larger maps grow it geometrically (a few chunks per load)
+const size_t INITIAL_CHUNK_SIZE = 64 * 1024;
+} // namespace
+
+LevelArena::LevelArena() : resource(INITIAL_CHUNK_SIZE) {}
+
+void LevelArena::release() { resource.release(); }
+} // namespace logic
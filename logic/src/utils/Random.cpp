@@ -1,29 +1,58 @@
 #include "logic/utils/Random.h"
+#include <random>
 
 namespace logic {
-Random* Random::instance = nullptr;
+Random::Random() : Random(0) {}
 
-Random::Random() {
-    std::random_device rd;
-    generator.seed(rd());
+Random::Random(uint64_t seed, uint64_t stream) : state(0), increment(1) { this->seed(seed, stream); }
+
+void Random::seed(uint64_t seed, uint64_t stream) {
+    // Reference PCG32 initialization (pcg32_srandom_r)
+    state = 0;
+    increment = (stream << 1u) | 1u;
+    next();
+    state += seed;
+    next();
 }
 
-Random& Random::getInstance() {
-    if (instance == nullptr) {
-        instance = new Random();
-    }
-    return *instance;
+uint32_t Random::next() {
+    uint64_t oldState = state;
+    state = oldState * 6364136223846793005ULL + increment;
+
+    // XSH-RR output: xorshift high bits, random rotation
+    uint32_t xorShifted = static_cast<uint32_t>(((oldState >> 18u) ^ oldState) >> 27u);
+    uint32_t rotation = static_cast<uint32_t>(oldState >> 59u);
+    return (xorShifted >> rotation) | (xorShifted << ((32u - rotation) & 31u));
 }
 
 int Random::getInt(int min, int max) {
     // Range: [min, max] (both inclusive)
-    std::uniform_int_distribution<int> dist(min, max);
-    return dist(generator);
+    uint32_t range = static_cast<uint32_t>(static_cast<int64_t>(max) - min) + 1u;
+    if (range == 0) {
+        return static_cast<int>(next()); // Full 32-bit range
+    }
+
+    // Lemire's multiply-shift with rejection (unbiased, usually no division)
+    uint64_t product = static_cast<uint64_t>(next()) * range;
+    uint32_t low = static_cast<uint32_t>(product);
+    if (low < range) {
+        uint32_t threshold = (0u - range) % range;
+        while (low < threshold) {
+            product = static_cast<uint64_t>(next()) * range;
+            low = static_cast<uint32_t>(product);
+        }
+    }
+    return static_cast<int>(min + static_cast<int64_t>(product >> 32));
 }
 
 float Random::getFloat(float min, float max) {
-    // Range: [min, max) (max exclusive)
-    std::uniform_real_distribution<float> dist(min, max);
-    return dist(generator);
+    // Range: [min, max) (max exclusive), 24 random mantissa bits
+    float unit = static_cast<float>(next() >> 8) * (1.0f / 16777216.0f);
+    return min + (max - min) * unit;
+}
+
+uint64_t Random::randomSeed() {
+    std::random_device device;
+    return (static_cast<uint64_t>(device()) << 32) ^ device();
 }
-} // namespace logic
\ No newline at end of file
+} // namespace logic
@@ -0,0 +1,66 @@
+#include "logic/world/DistanceField.h"
+#include <algorithm>
+
+namespace logic {
+namespace {
+// Cell offsets in MOVE_DIRECTIONS order (UP, DOWN, LEFT, RIGHT)
+const int COLUMN_OFFSETS[4] = {0, 0, -1, 1};
+const int ROW_OFFSETS[4] = {-1, 1, 0, 0};
+} // namespace
+
+DistanceField::DistanceField() : width(0), height(0) {}
+
+void DistanceField::compute(const TileGrid& grid, int sourceCol, int sourceRow, bool doorsBlock) {
+    width = grid.getWidth();
+    height = grid.getHeight();
+    distances.assign(static_cast<size_t>(width) * height, UNREACHABLE);
+
+    if (!grid.contains(sourceCol, sourceRow)) {
+        return;
+    }
+
+    queue.resize(distances.size());
+    size_t head = 0;
+    size_t tail = 0;
+
+    queue[tail++] = grid.cellIndex(sourceCol, sourceRow);
+    distances[grid.cellIndex(sourceCol, sourceRow)] = 0;
+
+    // Every cell is queued at most once, so the frontier never outgrows the cell count
+    while (head < tail) {
+        int cell = queue[head++];
+        int col = cell % width;
+        int row = cell / width;
+        uint16_t next = static_cast<uint16_t>(std::min<int>(distances[cell] + 1, UNREACHABLE - 1));
+        DirectionMask open = grid.getGhostDirectionMask(col, row, doorsBlock);
+
+        for (int i = 0; i < 4; i++) {
+            int neighbourCol = col + COLUMN_OFFSETS[i];
+            int neighbourRow = row + ROW_OFFSETS[i];
+            if (!(open & directionBit(MOVE_DIRECTIONS[i])) || !grid.contains(neighbourCol, neighbourRow)) {
+                continue;
+            }
+
+            int neighbour = grid.cellIndex(neighbourCol, neighbourRow);
+            if (distances[neighbour] == UNREACHABLE) {
+                distances[neighbour] = next;
+                queue[tail++] = neighbour;
+            }
+        }
+    }
+}
+
+void DistanceField::clear() {
+    width = 0;
+    height = 0;
+    distances.clear();
+}
+
+DirectionDistances DistanceField::getNeighbours(int col, int row) const {
+    DirectionDistances result;
+    for (int i = 0; i < 4; i++) {
+        result[i] = get(col + COLUMN_OFFSETS[i], row + ROW_OFFSETS[i]);
+    }
+    return result;
+}
+} // namespace logic
@@ -0,0 +1,532 @@
+#include "logic/world/HierarchicalPathfinder.h"
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+
+namespace logic {
+namespace {
+// Cell offsets in MOVE_DIRECTIONS order (UP, DOWN, LEFT, RIGHT); the opposite of direction i is i ^ 1
+const int COLUMN_OFFSETS[4] = {0, 0, -1, 1};
+const int ROW_OFFSETS[4] = {-1, 1, 0, 0};
+
+// Entrances at least this wide get a transition at both ends instead of one in the middle
+const int WIDE_ENTRANCE = 6;
+} // namespace
+
+HierarchicalPathfinder::HierarchicalPathfinder()
+    : width(0), height(0), clustersX(0), clustersY(0), startLinkEnd{}, goalCell(-1), queryStamp(0) {}
+
+void HierarchicalPathfinder::build(const TileGrid& grid, bool doorsBlock) {
+    clear();
+
+    width = grid.getWidth();
+    height = grid.getHeight();
+    clustersX = (width + CLUSTER_SIZE - 1) / CLUSTER_SIZE;
+    clustersY = (height + CLUSTER_SIZE - 1) / CLUSTER_SIZE;
+
+    size_t cellCount = static_cast<size_t>(width) * height;
+    masks.resize(cellCount);
+    for (int row = 0; row < height; row++) {
+        for (int col = 0; col < width; col++) {
+            masks[static_cast<size_t>(row) * width + col] = grid.getGhostDirectionMask(col, row, doorsBlock);
+        }
+    }
+
+    localQueue.resize(EXACT_WINDOW * EXACT_WINDOW);
+    windowDistances.resize(EXACT_WINDOW * EXACT_WINDOW);
+    localDistances.resize(CLUSTER_SIZE * CLUSTER_SIZE);
+    goalLocalDistances.resize(CLUSTER_SIZE * CLUSTER_SIZE);
+
+    labelComponents();
+
+    std::vector<int> regions(cellCount, -1);
+    labelRegions(regions);
+
+    std::vector<int> nodeAtCell(cellCount, -1);
+    std::vector<std::pair<int, Edge>> links;
+    buildEntrances(regions, nodeAtCell, links);
+
+    // Group nodes by cluster (counting sort keeps creation order inside a cluster)
+    size_t clusterCount = static_cast<size_t>(clustersX) * clustersY;
+    clusterNodeStart.assign(clusterCount + 1, 0);
+    for (const Node& node : nodes) {
+        clusterNodeStart[clusterOf(node.col, node.row) + 1]++;
+    }
+    for (size_t i = 0; i < clusterCount; i++) {
+        clusterNodeStart[i + 1] += clusterNodeStart[i];
+    }
+
+    clusterNodes.resize(nodes.size());
+    std::vector<int> cursor(clusterNodeStart.begin(), clusterNodeStart.end() - 1);
+    for (size_t node = 0; node < nodes.size(); node++) {
+        clusterNodes[cursor[clusterOf(nodes[node].col, nodes[node].row)]++] = static_cast<int>(node);
+    }
+
+    buildIntraClusterEdges(links);
+
+    edgeStart.assign(nodes.size() + 1, 0);
+    for (const auto& link : links) {
+        edgeStart[link.first + 1]++;
+    }
+    for (size_t i = 0; i < nodes.size(); i++) {
+        edgeStart[i + 1] += edgeStart[i];
+    }
+
+    edges.resize(links.size());
+    cursor.assign(edgeStart.begin(), edgeStart.end() - 1);
+    for (const auto& [from, edge] : links) {
+        edges[cursor[from]++] = edge;
+    }
+
+    nodeCosts.assign(nodes.size(), 0);
+    nodeStamps.assign(nodes.size(), 0);
+    closedStamps.assign(nodes.size(), 0);
+    startStamps.assign(nodes.size(), 0);
+}
+
+void HierarchicalPathfinder::clear() {
+    width = 0;
+    height = 0;
+    clustersX = 0;
+    clustersY = 0;
+    masks.clear();
+    components.clear();
+    nodes.clear();
+    clusterNodeStart.clear();
+    clusterNodes.clear();
+    edgeStart.clear();
+    edges.clear();
+    goalLinks.clear();
+    startLinks.clear();
+    goalCell = -1;
+    queryStamp = 0;
+}
+
+void HierarchicalPathfinder::labelComponents() {
+    components.assign(masks.size(), -1);
+    std::vector<int> queue(masks.size());
+    int component = 0;
+
+    for (size_t start = 0; start < masks.size(); start++) {
+        if (components[start] >= 0) {
+            continue;
+        }
+
+        size_t head = 0;
+        size_t tail = 0;
+        queue[tail++] = static_cast<int>(start);
+        components[start] = component;
+
+        while (head < tail) {
+            int cell = queue[head++];
+            int col = cell % width;
+            int row = cell / width;
+
+            for (int i = 0; i < 4; i++) {
+                int neighbourCol = col + COLUMN_OFFSETS[i];
+                int neighbourRow = row + ROW_OFFSETS[i];
+                if (!(masks[cell] & directionBit(MOVE_DIRECTIONS[i])) || neighbourCol < 0 || neighbourCol >= width ||
+                    neighbourRow < 0 || neighbourRow >= height) {
+                    continue;
+                }
+
+                // Both directions must be open: wall cells also carry masks towards their open neighbours
+                int neighbour = neighbourRow * width + neighbourCol;
+                if (!(masks[neighbour] & directionBit(MOVE_DIRECTIONS[i ^ 1])) || components[neighbour] >= 0) {
+                    continue;
+                }
+
+                components[neighbour] = component;
+                queue[tail++] = neighbour;
+            }
+        }
+        component++;
+    }
+}
+
+void HierarchicalPathfinder::labelRegions(std::vector<int>& regions) {
+    int region = 0;
+
+    for (int row = 0; row < height; row++) {
+        for (int col = 0; col < width; col++) {
+            if (regions[row * width + col] >= 0) {
+                continue;
+            }
+
+            searchCluster(col, row, localDistances);
+
+            int left = col - col % CLUSTER_SIZE;
+            int top = row - row % CLUSTER_SIZE;
+            for (int index = 0; index < CLUSTER_SIZE * CLUSTER_SIZE; index++) {
+                if (localDistances[index] >= 0) {
+                    regions[(top + index / CLUSTER_SIZE) * width + left + index % CLUSTER_SIZE] = region;
+                }
+            }
+            region++;
+        }
+    }
+}
+
+int HierarchicalPathfinder::addNode(int col, int row, std::vector<int>& nodeAtCell) {
+    int cell = row * width + col;
+    if (nodeAtCell[cell] < 0) {
+        nodeAtCell[cell] = static_cast<int>(nodes.size());
+        nodes.push_back({col, row, localIndex(col, row)});
+    }
+    return nodeAtCell[cell];
+}
+
+void HierarchicalPathfinder::buildEntrances(const std::vector<int>& regions, std::vector<int>& nodeAtCell,
+                                            std::vector<std::pair<int, Edge>>& links) {
+    // Transition between cell (col, row) and its neighbour in direction i, one step apart
+    auto addTransition = [&](int col, int row, int i) {
+        int from = addNode(col, row, nodeAtCell);
+        int to = addNode(col + COLUMN_OFFSETS[i], row + ROW_OFFSETS[i], nodeAtCell);
+        links.push_back({from, {to, 1}});
+        links.push_back({to, {from, 1}});
+    };
+
+    auto isOpen = [&](int col, int row, int i) {
+        int neighbour = (row + ROW_OFFSETS[i]) * width + col + COLUMN_OFFSETS[i];
+        return (masks[row * width + col] & directionBit(MOVE_DIRECTIONS[i])) &&
+               (masks[neighbour] & directionBit(MOVE_DIRECTIONS[i ^ 1]));
+    };
+
+    auto regionsOf = [&](int col, int row, int i) {
+        int neighbour = (row + ROW_OFFSETS[i]) * width + col + COLUMN_OFFSETS[i];
+        return std::make_pair(regions[row * width + col], regions[neighbour]);
+    };
+
+    // Scans one cluster border (cells (col, row) + step * k, crossing in direction i, step direction along).
+    // Neighbouring crossings join one entrance when they connect the same two regions and the border cells
+    // between them are open on one side, so the detour through the entrance stays below the entrance width
+    // (pillars split a border into many one-cell openings behind one open corridor).
+    auto scanBorder = [&](int col, int row, int stepCol, int stepRow, int length, int i, int along) {
+        int crossings[CLUSTER_SIZE]; // Crossings of the current entrance
+        int count = 0;
+
+        auto addEntrance = [&]() {
+            int first = crossings[0];
+            int last = crossings[count - 1];
+            if (last - first + 1 >= WIDE_ENTRANCE) {
+                addTransition(col + stepCol * first, row + stepRow * first, i);
+                addTransition(col + stepCol * last, row + stepRow * last, i);
+            } else {
+                int middle = crossings[count / 2];
+                addTransition(col + stepCol * middle, row + stepRow * middle, i);
+            }
+        };
+
+        bool sideOpen = true;      // Border cells on this side open from last crossing up to k
+        bool otherSideOpen = true; // Same, across the border
+        for (int k = 0; k < length; k++) {
+            int cellCol = col + stepCol * k;
+            int cellRow = row + stepRow * k;
+            if (k > 0) {
+                int previousCol = cellCol - stepCol;
+                int previousRow = cellRow - stepRow;
+                sideOpen = sideOpen && isOpen(previousCol, previousRow, along);
+                otherSideOpen = otherSideOpen &&
+                                isOpen(previousCol + COLUMN_OFFSETS[i], previousRow + ROW_OFFSETS[i], along);
+            }
+
+            if (!isOpen(cellCol, cellRow, i)) {
+                continue;
+            }
+
+            int last = count > 0 ? crossings[count - 1] : 0;
+            bool joins = count > 0 && (sideOpen || otherSideOpen) &&
+                         regionsOf(cellCol, cellRow, i) == regionsOf(col + stepCol * last, row + stepRow * last, i);
+            if (!joins && count > 0) {
+                addEntrance();
+                count = 0;
+            }
+
+            crossings[count++] = k;
+            sideOpen = true;
+            otherSideOpen = true;
+        }
+
+        if (count > 0) {
+            addEntrance();
+        }
+    };
+
+    const int DOWN = 1;
+    const int RIGHT = 3;
+
+    for (int top = 0; top < height; top += CLUSTER_SIZE) {
+        int rows = std::min(CLUSTER_SIZE, height - top);
+        for (int col = CLUSTER_SIZE - 1; col + 1 < width; col += CLUSTER_SIZE) {
+            scanBorder(col, top, 0, 1, rows, RIGHT, DOWN);
+        }
+    }
+
+    for (int left = 0; left < width; left += CLUSTER_SIZE) {
+        int cols = std::min(CLUSTER_SIZE, width - left);
+        for (int row = CLUSTER_SIZE - 1; row + 1 < height; row += CLUSTER_SIZE) {
+            scanBorder(left, row, 1, 0, cols, DOWN, RIGHT);
+        }
+    }
+}
+
+void HierarchicalPathfinder::buildIntraClusterEdges(std::vector<std::pair<int, Edge>>& links) {
+    for (size_t cluster = 0; cluster + 1 < clusterNodeStart.size(); cluster++) {
+        for (int i = clusterNodeStart[cluster]; i < clusterNodeStart[cluster + 1]; i++) {
+            int from = clusterNodes[i];
+            searchCluster(nodes[from].col, nodes[from].row, localDistances);
+
+            for (int j = clusterNodeStart[cluster]; j < clusterNodeStart[cluster + 1]; j++) {
+                int to = clusterNodes[j];
+                int distance = localDistances[nodes[to].localIndex];
+                if (to != from && distance > 0) {
+                    links.push_back({from, {to, distance}});
+                }
+            }
+        }
+    }
+}
+
+void HierarchicalPathfinder::searchArea(int left, int top, int areaWidth, int areaHeight, int stride, int col,
+                                        int row, std::vector<int>& distances) {
+    std::fill(distances.begin(), distances.end(), -1);
+
+    // Queue holds packed area-local coordinates: no division by the (runtime) grid width per visited cell
+    size_t head = 0;
+    size_t tail = 0;
+    localQueue[tail++] = ((row - top) << 8) | (col - left);
+    distances[(row - top) * stride + col - left] = 0;
+
+    while (head < tail) {
+        int localCol = localQueue[head] & 0xFF;
+        int localRow = localQueue[head++] >> 8;
+        int next = distances[localRow * stride + localCol] + 1;
+        DirectionMask open = masks[static_cast<size_t>(top + localRow) * width + left + localCol];
+
+        for (int i = 0; i < 4; i++) {
+            int neighbourCol = localCol + COLUMN_OFFSETS[i];
+            int neighbourRow = localRow + ROW_OFFSETS[i];
+            if (!(open & directionBit(MOVE_DIRECTIONS[i])) || neighbourCol < 0 || neighbourCol >= areaWidth ||
+                neighbourRow < 0 || neighbourRow >= areaHeight) {
+                continue;
+            }
+
+            int index = neighbourRow * stride + neighbourCol;
+            DirectionMask back = masks[static_cast<size_t>(top + neighbourRow) * width + left + neighbourCol];
+            if (distances[index] >= 0 || !(back & directionBit(MOVE_DIRECTIONS[i ^ 1]))) {
+                continue;
+            }
+
+            distances[index] = next;
+            localQueue[tail++] = (neighbourRow << 8) | neighbourCol;
+        }
+    }
+}
+
+void HierarchicalPathfinder::searchCluster(int col, int row, std::vector<int>& distances) {
+    int left = col - col % CLUSTER_SIZE;
+    int top = row - row % CLUSTER_SIZE;
+    searchArea(left, top, std::min(CLUSTER_SIZE, width - left), std::min(CLUSTER_SIZE, height - top), CLUSTER_SIZE,
+               col, row, distances);
+}
+
+void HierarchicalPathfinder::prepareGoal(int targetCol, int targetRow) {
+    int cell = targetRow * width + targetCol;
+    if (cell == goalCell) {
+        return;
+    }
+
+    // Several ghosts usually query the same target in one tick: the target end is refined once
+    goalCell = cell;
+    searchCluster(targetCol, targetRow, goalLocalDistances);
+
+    goalLinks.clear();
+    int cluster = clusterOf(targetCol, targetRow);
+    for (int i = clusterNodeStart[cluster]; i < clusterNodeStart[cluster + 1]; i++) {
+        int node = clusterNodes[i];
+        int distance = goalLocalDistances[nodes[node].localIndex];
+        if (distance >= 0) {
+            goalLinks.push_back({node, distance});
+        }
+    }
+}
+
+bool HierarchicalPathfinder::isConnected(int col, int row, int otherCol, int otherRow) const {
+    if (col < 0 || col >= width || row < 0 || row >= height || otherCol < 0 || otherCol >= width || otherRow < 0 ||
+        otherRow >= height) {
+        return false;
+    }
+    return components[row * width + col] == components[otherRow * width + otherCol];
+}
+
+DirectionDistances HierarchicalPathfinder::getNeighbourDistances(int col, int row, int targetCol, int targetRow) {
+    DirectionDistances result;
+    result.fill(UNREACHABLE);
+
+    if (isEmpty() || targetCol < 0 || targetCol >= width || targetRow < 0 || targetRow >= height) {
+        return result;
+    }
+
+    int best[4];
+    bool active[4];
+    bool anyActive = false;
+    for (int i = 0; i < 4; i++) {
+        best[i] = INT_MAX;
+        active[i] = isConnected(col + COLUMN_OFFSETS[i], row + ROW_OFFSETS[i], targetCol, targetRow);
+        anyActive = anyActive || active[i];
+    }
+
+    if (!anyActive) {
+        return result;
+    }
+
+    // Target close by: exact BFS in a window around both ends (the abstract graph routes through
+    // transition cells, which shows most on short paths). Done when it reaches every neighbour.
+    if (std::abs(targetCol - col) <= CLUSTER_SIZE && std::abs(targetRow - row) <= CLUSTER_SIZE) {
+        const int MARGIN = CLUSTER_SIZE / 2;
+        int left = std::max(0, std::min(col, targetCol) - MARGIN);
+        int top = std::max(0, std::min(row, targetRow) - MARGIN);
+        int right = std::min(width, std::max(col, targetCol) + MARGIN + 1);
+        int bottom = std::min(height, std::max(row, targetRow) + MARGIN + 1);
+        searchArea(left, top, right - left, bottom - top, EXACT_WINDOW, targetCol, targetRow, windowDistances);
+
+        bool complete = true;
+        for (int i = 0; i < 4; i++) {
+            int neighbourCol = col + COLUMN_OFFSETS[i];
+            int neighbourRow = row + ROW_OFFSETS[i];
+            if (!active[i]) {
+                continue;
+            }
+
+            int distance = -1;
+            if (neighbourCol >= left && neighbourCol < right && neighbourRow >= top && neighbourRow < bottom) {
+                distance = windowDistances[(neighbourRow - top) * EXACT_WINDOW + neighbourCol - left];
+            }
+
+            if (distance >= 0) {
+                best[i] = distance;
+                result[i] = static_cast<uint16_t>(distance);
+            } else {
+                complete = false;
+            }
+        }
+
+        if (complete) {
+            return result;
+        }
+    }
+
+    prepareGoal(targetCol, targetRow);
+
+    if (++queryStamp == 0) {
+        std::fill(nodeStamps.begin(), nodeStamps.end(), 0);
+        std::fill(closedStamps.begin(), closedStamps.end(), 0);
+        std::fill(startStamps.begin(), startStamps.end(), 0);
+        queryStamp = 1;
+    }
+
+    // Refine the start end: link every neighbour to the transition cells of its cluster
+    int targetCluster = clusterOf(targetCol, targetRow);
+    startLinks.clear();
+
+    for (int i = 0; i < 4; i++) {
+        int neighbourCol = col + COLUMN_OFFSETS[i];
+        int neighbourRow = row + ROW_OFFSETS[i];
+        if (active[i]) {
+            int cluster = clusterOf(neighbourCol, neighbourRow);
+            if (cluster == targetCluster) {
+                int direct = goalLocalDistances[localIndex(neighbourCol, neighbourRow)];
+                best[i] = direct >= 0 ? std::min(best[i], direct) : best[i];
+            }
+
+            searchCluster(neighbourCol, neighbourRow, localDistances);
+            for (int j = clusterNodeStart[cluster]; j < clusterNodeStart[cluster + 1]; j++) {
+                int node = clusterNodes[j];
+                int distance = localDistances[nodes[node].localIndex];
+                if (distance >= 0) {
+                    startLinks.push_back({node, distance});
+                    startStamps[node] = queryStamp;
+                }
+            }
+        }
+        startLinkEnd[i] = static_cast<int>(startLinks.size());
+    }
+
+    // Lower bound from a node to any neighbour (neighbours are one step from (col, row))
+    auto heuristic = [&](int node) {
+        return std::max(0, std::abs(nodes[node].col - col) + std::abs(nodes[node].row - row) - 1);
+    };
+
+    // Heap order: smallest estimate first, then smallest heuristic
+    auto later = [](const OpenEntry& a, const OpenEntry& b) {
+        return a.estimate != b.estimate ? a.estimate > b.estimate : a.heuristic > b.heuristic;
+    };
+
+    auto push = [&](int node, int cost) {
+        if (nodeStamps[node] == queryStamp && nodeCosts[node] <= cost) {
+            return;
+        }
+        nodeStamps[node] = queryStamp;
+        nodeCosts[node] = cost;
+        // Heuristic weighted by 9/8: open mazes have wide plateaus of nearly equal estimates that an exact
+        // A* expands completely; far distances may come out up to 1/8 long in exchange
+        int remaining = heuristic(node);
+        open.push_back({cost + remaining + remaining / 8, remaining, node});
+        std::push_heap(open.begin(), open.end(), later);
+    };
+
+    open.clear();
+    for (const auto& [node, distance] : goalLinks) {
+        push(node, distance);
+    }
+
+    // Backward A* from the target's entrances; stops once no open node can improve any neighbour
+    while (!open.empty()) {
+        int bound = -1;
+        for (int i = 0; i < 4; i++) {
+            if (active[i]) {
+                bound = std::max(bound, best[i]);
+            }
+        }
+
+        std::pop_heap(open.begin(), open.end(), later);
+        OpenEntry entry = open.back();
+        open.pop_back();
+
+        int node = entry.node;
+        if (entry.estimate >= bound) {
+            break;
+        }
+        if (closedStamps[node] == queryStamp) {
+            continue;
+        }
+        closedStamps[node] = queryStamp;
+
+        int cost = nodeCosts[node];
+        if (startStamps[node] == queryStamp) {
+            int begin = 0;
+            for (int i = 0; i < 4; i++) {
+                for (int j = begin; j < startLinkEnd[i]; j++) {
+                    if (startLinks[j].first == node) {
+                        best[i] = std::min(best[i], cost + startLinks[j].second);
+                    }
+                }
+                begin = startLinkEnd[i];
+            }
+        }
+
+        for (int e = edgeStart[node]; e < edgeStart[node + 1]; e++) {
+            if (closedStamps[edges[e].target] != queryStamp) {
+                push(edges[e].target, cost + edges[e].cost);
+            }
+        }
+    }
+
+    for (int i = 0; i < 4; i++) {
+        if (best[i] != INT_MAX) {
+            result[i] = static_cast<uint16_t>(std::min(best[i], static_cast<int>(UNREACHABLE) - 1));
+        }
+    }
+    return result;
+}
+} // namespace logic
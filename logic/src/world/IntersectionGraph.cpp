@@ -0,0 +1,124 @@
+#include "logic/world/IntersectionGraph.h"
+
+namespace logic {
+namespace {
+// Cell offsets in MOVE_DIRECTIONS order (UP, DOWN, LEFT, RIGHT); index ^ 1 is the opposite direction
+const int COLUMN_OFFSETS[4] = {0, 0, -1, 1};
+const int ROW_OFFSETS[4] = {-1, 1, 0, 0};
+
+int directionIndex(Direction dir) {
+    switch (dir) {
+    case Direction::UP:
+        return 0;
+    case Direction::DOWN:
+        return 1;
+    case Direction::LEFT:
+        return 2;
+    case Direction::RIGHT:
+        return 3;
+    case Direction::NONE:
+        break;
+    }
+    return -1;
+}
+
+const IntersectionGraph::Edge CLOSED_EDGE = {IntersectionGraph::NO_NODE, 0, Direction::NONE};
+} // namespace
+
+IntersectionGraph::IntersectionGraph() : width(0), height(0), edgeCount(0) {}
+
+void IntersectionGraph::build(const TileGrid& grid, bool doorsBlock) {
+    clear();
+    width = grid.getWidth();
+    height = grid.getHeight();
+
+    uint8_t blocking = TileGrid::WALL | TileGrid::NO_ENTRY | (doorsBlock ? TileGrid::DOOR : 0);
+    exits.assign(static_cast<size_t>(width) * height, 0);
+    nodeAtCell.assign(exits.size(), NO_NODE);
+
+    // Wall cells also carry mask bits towards their open neighbours, so only open pairs inside the grid count
+    for (int row = 0; row < height; row++) {
+        for (int col = 0; col < width; col++) {
+            if (grid.getFlags(col, row) & blocking) {
+                continue;
+            }
+
+            DirectionMask open = grid.getGhostDirectionMask(col, row, doorsBlock);
+            DirectionMask cellExits = 0;
+            for (int i = 0; i < 4; i++) {
+                if ((open & directionBit(MOVE_DIRECTIONS[i])) &&
+                    grid.contains(col + COLUMN_OFFSETS[i], row + ROW_OFFSETS[i])) {
+                    cellExits |= directionBit(MOVE_DIRECTIONS[i]);
+                }
+            }
+
+            size_t cell = static_cast<size_t>(row) * width + col;
+            exits[cell] = cellExits;
+
+            // Corridor cells (straight runs and corners) have exactly two exits
+            if (cellExits != 0 && directionCount(cellExits) != 2) {
+                nodeAtCell[cell] = static_cast<int>(nodes.size());
+                nodes.push_back({col, row, cellExits});
+            }
+        }
+    }
+
+    edges.assign(nodes.size() * 4, CLOSED_EDGE);
+    for (size_t node = 0; node < nodes.size(); node++) {
+        for (int i = 0; i < 4; i++) {
+            if (nodes[node].exits & directionBit(MOVE_DIRECTIONS[i])) {
+                traceEdge(static_cast<int>(node), i);
+            }
+        }
+    }
+}
+
+void IntersectionGraph::traceEdge(int node, int directionIndex) {
+    int col = nodes[node].col;
+    int row = nodes[node].row;
+    int heading = directionIndex;
+
+    // A corridor visits every cell at most once, so a longer walk is a loop without nodes
+    size_t maxSteps = exits.size();
+    for (size_t length = 1; length <= maxSteps; length++) {
+        col += COLUMN_OFFSETS[heading];
+        row += ROW_OFFSETS[heading];
+
+        int target = nodeAtCell[static_cast<size_t>(row) * width + col];
+        if (target != NO_NODE) {
+            edges[static_cast<size_t>(node) * 4 + directionIndex] = {target, static_cast<int>(length),
+                                                                     MOVE_DIRECTIONS[heading]};
+            edgeCount++;
+            return;
+        }
+
+        // Corridor cell: leave through the exit that is not the way back
+        DirectionMask onward = exits[static_cast<size_t>(row) * width + col] &
+                               ~directionBit(MOVE_DIRECTIONS[heading ^ 1]);
+        for (int i = 0; i < 4; i++) {
+            if (onward & directionBit(MOVE_DIRECTIONS[i])) {
+                heading = i;
+                break;
+            }
+        }
+    }
+}
+
+void IntersectionGraph::clear() {
+    width = 0;
+    height = 0;
+    exits.clear();
+    nodeAtCell.clear();
+    nodes.clear();
+    edges.clear();
+    edgeCount = 0;
+}
+
+const IntersectionGraph::Edge& IntersectionGraph::getEdge(int node, Direction direction) const {
+    int index = directionIndex(direction);
+    if (index < 0) {
+        return CLOSED_EDGE;
+    }
+    return edges[static_cast<size_t>(node) * 4 + index];
+}
+} // namespace logic
@@ -0,0 +1,214 @@
+#include "logic/world/LevelSession.h"
+#include <algorithm>
+
+namespace logic {
+LevelSession::LevelSession(World& world)
+    : world(world), countingDown(true), countdownTimer(START_COUNTDOWN), tick(0), nextPlaybackInput(0) {}
+
+LevelStep LevelSession::update(float deltaTime) {
+    if (playback) {
+        const auto& inputs = playback->inputs;
+        while (nextPlaybackInput < inputs.size() && inputs[nextPlaybackInput].tick <= tick) {
+            performInput(inputs[nextPlaybackInput].action);
+            nextPlaybackInput++;
+        }
+    }
+
+    LevelStep result = step(deltaTime);
+    tick++;
+
+    if (recording) {
+        // Fixed step: every tick has the same duration
+        recording->tickDuration = deltaTime;
+
+        // Keyframe holds the state before the next tick's inputs (they are applied between updates)
+        if (tick % recording->keyframeInterval == 0) {
+            captureKeyframe();
+        }
+    }
+    return result;
+}
+
+LevelStep LevelSession::step(float deltaTime) {
+    if (countingDown) {
+        world.storePreviousPositions();
+
+        countdownTimer -= deltaTime;
+
+        if (countdownTimer <= 0.0f) {
+            countingDown = false;
+            world.clearRespawnFlag();
+        }
+        return LevelStep::COUNTDOWN;
+    }
+
+    // Respawn triggers new countdown (after death)
+    if (world.justRespawned()) {
+        world.storePreviousPositions();
+        startCountdown(RESPAWN_COUNTDOWN);
+        return LevelStep::RESPAWNED;
+    }
+
+    world.update(deltaTime);
+
+    // Victory: All coins collected → next level
+    if (world.getCoinsCollected() >= world.getTotalCoins()) {
+        completeLevel();
+        return LevelStep::LEVEL_CLEARED;
+    }
+
+    if (isGameOver()) {
+        return LevelStep::GAME_OVER;
+    }
+    return LevelStep::PLAYING;
+}
+
+void LevelSession::applyInput(InputAction action) {
+    if (playback) {
+        return;
+    }
+
+    auto pacman = world.getPacMan();
+    if (!pacman) {
+        return;
+    }
+
+    bool isDirection = action != InputAction::FEAR_CHEAT && action != InputAction::LEVEL_CHEAT;
+    Direction current = pacman->getCurrentDirection();
+    if (isDirection && current != Direction::NONE && inputActionFor(current) == action) {
+        return;
+    }
+
+    if (recording) {
+        recording->inputs.push_back({tick, action});
+    }
+    performInput(action);
+}
+
+void LevelSession::performInput(InputAction action) {
+    switch (action) {
+    case InputAction::FEAR_CHEAT:
+        world.activateFearMode();
+        return;
+    case InputAction::LEVEL_CHEAT:
+        completeLevel();
+        return;
+    default:
+        break;
+    }
+
+    // Playback reaches this directly: a map without 'C' spawn (or an edited replay) has no PacMan
+    auto pacman = world.getPacMan();
+    if (!pacman) {
+        return;
+    }
+
+    switch (action) {
+    case InputAction::UP:
+        pacman->setNextDirection(Direction::UP);
+        break;
+    case InputAction::DOWN:
+        pacman->setNextDirection(Direction::DOWN);
+        break;
+    case InputAction::LEFT:
+        pacman->setNextDirection(Direction::LEFT);
+        break;
+    case InputAction::RIGHT:
+        pacman->setNextDirection(Direction::RIGHT);
+        break;
+    default:
+        break;
+    }
+}
+
+void LevelSession::startRecording(const std::string& mapFile) {
+    recording = std::make_unique<Replay>();
+    recording->mapFile = mapFile;
+    recording->seed = world.getSeed();
+    captureKeyframe();
+}
+
+void LevelSession::captureKeyframe() {
+    Keyframe keyframe{tick, {}};
+    ByteWriter writer(keyframe.state);
+    writer.writeByte(countingDown ? 1 : 0);
+    writer.writeFloat(countdownTimer);
+    world.writeState(writer);
+    recording->keyframes.push_back(std::move(keyframe));
+}
+
+void LevelSession::restoreKeyframe(const Keyframe& keyframe) {
+    ByteReader reader(keyframe.state.data(), keyframe.state.size());
+    countingDown = reader.readByte() != 0;
+    countdownTimer = reader.readFloat();
+    world.readState(reader);
+
+    tick = keyframe.tick;
+    nextPlaybackInput = playback->findInput(tick);
+}
+
+void LevelSession::seek(uint32_t targetTick) {
+    if (!playback) {
+        return;
+    }
+    targetTick = std::min(targetTick, playback->tickCount);
+
+    // Jump to the nearest keyframe unless simulating forward from here is shorter
+    const Keyframe* keyframe = playback->findKeyframe(targetTick);
+    if (keyframe && (targetTick < tick || keyframe->tick > tick)) {
+        restoreKeyframe(*keyframe);
+    }
+
+    while (tick < targetTick) {
+        if (update(playback->tickDuration) == LevelStep::GAME_OVER) {
+            break;
+        }
+    }
+}
+
+const Replay* LevelSession::finishRecording() {
+    if (recording) {
+        recording->tickCount = tick;
+        recording->finalChecksum = world.checksum();
+    }
+    return recording.get();
+}
+
+void LevelSession::startPlayback(const Replay& replay) {
+    playback = std::make_unique<Replay>(replay);
+    nextPlaybackInput = 0;
+}
+
+void LevelSession::startCountdown(float duration) {
+    countingDown = true;
+    countdownTimer = duration;
+}
+
+void LevelSession::restart() {
+    world.restart();
+    countingDown = true;
+    countdownTimer = START_COUNTDOWN;
+    tick = 0;
+    nextPlaybackInput = 0;
+
+    if (recording) {
+        recording->seed = world.getSeed();
+        recording->inputs.clear();
+        recording->keyframes.clear();
+        captureKeyframe();
+    }
+}
+
+void LevelSession::completeLevel() {
+    world.getScoreObject()->setEvent(ScoreEvent::LEVEL_CLEARED);
+    world.getScoreSubject()->notify();
+
+    world.nextLevel();
+    startCountdown(LEVEL_COUNTDOWN);
+}
+
+bool LevelSession::isGameOver() const {
+    auto pacman = world.getPacMan();
+    return pacman && pacman->getLives() <= 0;
+}
+} // namespace logic
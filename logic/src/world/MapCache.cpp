@@ -0,0 +1,108 @@
+#include "logic/world/MapCache.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define PACMANGAME_MAPCACHE_STAT 1
+#include <sys/stat.h>
+#else
+#include <filesystem>
+#endif
+
+namespace logic {
+namespace {
+/**
+ * Modification time and size of filename, false if it doesn't exist.
+ * One stat() call on POSIX, so both come from the same version of the file.
+ */
+bool readFileStamp(const std::string& filename, MapCache::FileStamp& stamp) {
+#ifdef PACMANGAME_MAPCACHE_STAT
+    struct stat status;
+    if (::stat(filename.c_str(), &status) != 0) {
+        return false;
+    }
+#ifdef __APPLE__
+    const timespec& modified = status.st_mtimespec;
+#else
+    const timespec& modified = status.st_mtim;
+#endif
+    stamp.modified = static_cast<int64_t>(modified.tv_sec) * 1000000000 + modified.tv_nsec;
+    stamp.size = static_cast<uintmax_t>(status.st_size);
+    return true;
+#else
+    // Two queries here (std::filesystem has no combined one), so not atomic against concurrent edits
+    std::error_code error;
+    auto modified = std::filesystem::last_write_time(filename, error);
+    if (error) {
+        return false;
+    }
+    stamp.modified = static_cast<int64_t>(modified.time_since_epoch().count());
+    stamp.size = std::filesystem::file_size(filename, error);
+    return !error;
+#endif
+}
+} // namespace
+
+MapCache::MapCache() : hits(0), misses(0) {}
+
+MapCache& MapCache::getInstance() {
+    // Function-local static: initialization is thread safe (batch simulations load maps in parallel)
+    static MapCache instance;
+    return instance;
+}
+
+std::shared_ptr<const MapData> MapCache::load(const std::string& filename) {
+    FileStamp stamp{};
+    if (!readFileStamp(filename, stamp)) {
+        return MapData::load(filename); // Reports the missing file
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(filename);
+        if (it != entries.end() && it->second.stamp == stamp) {
+            hits++;
+            return it->second.map;
+        }
+        misses++;
+    }
+
+    // Loaded outside the lock: threads loading other maps don't wait, a concurrent miss on the same map
+    // only loads it twice
+    std::shared_ptr<const MapData> map = MapData::load(filename);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    entries[filename] = {stamp, map};
+    return map;
+}
+
+std::pair<int, int> MapCache::getDimensions(const std::string& filename) {
+    FileStamp stamp{};
+    if (readFileStamp(filename, stamp)) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(filename);
+        if (it != entries.end() && it->second.stamp == stamp) {
+            return {it->second.map->getWidth(), it->second.map->getHeight()};
+        }
+    }
+    return MapData::readDimensions(filename);
+}
+
+void MapCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+}
+
+size_t MapCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+size_t MapCache::getHits() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return hits;
+}
+
+size_t MapCache::getMisses() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return misses;
+}
+} // namespace logic
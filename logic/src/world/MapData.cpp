@@ -0,0 +1,336 @@
+#include "logic/world/MapData.h"
+#include "logic/world/TileGrid.h"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define PACMANGAME_MAPDATA_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace logic {
+namespace {
+const char FILE_MAGIC[4] = {'P', 'M', 'A', 'P'};
+
+size_t align8(size_t size) { return (size + 7) & ~static_cast<size_t>(7); }
+
+/**
+ * Byte offsets of the compiled sections.
+ */
+struct Layout {
+    size_t spawnOffset;
+    size_t symbolOffset;
+    size_t tileOffset;
+    size_t maskOffset;
+    size_t size;
+};
+
+Layout layoutFor(size_t cells, size_t spawnCount) {
+    Layout layout;
+    layout.spawnOffset = align8(sizeof(MapData::Header));
+    layout.symbolOffset = align8(layout.spawnOffset + spawnCount * sizeof(uint32_t));
+    layout.tileOffset = align8(layout.symbolOffset + cells);
+    layout.maskOffset = align8(layout.tileOffset + cells);
+    layout.size = align8(layout.maskOffset + cells * 2 * sizeof(DirectionMask));
+    return layout;
+}
+
+/**
+ * TileGrid flags a map symbol sets on its cell (see World::loadMap for the symbols).
+ */
+uint8_t tileFlagsFor(char symbol) {
+    switch (symbol) {
+    case '#':
+        return TileGrid::WALL;
+    case 'D':
+        return TileGrid::DOOR;
+    case 'B':
+        return TileGrid::NO_ENTRY | TileGrid::NO_ENTRY_ORANGE; // BLUE's spawn keeps ORANGE out
+    case 'O':
+        return TileGrid::NO_ENTRY | TileGrid::NO_ENTRY_BLUE; // ORANGE's spawn keeps BLUE out
+    case 'N':
+        return TileGrid::NO_ENTRY | TileGrid::NO_ENTRY_ALL;
+    default:
+        return 0;
+    }
+}
+
+bool createsEntity(char symbol) {
+    switch (symbol) {
+    case '#':
+    case 'D':
+    case 'C':
+    case 'R':
+    case 'P':
+    case 'B':
+    case 'O':
+    case '.':
+    case 'N':
+    case 'F':
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool isGhost(char symbol) { return symbol == 'R' || symbol == 'P' || symbol == 'B' || symbol == 'O'; }
+
+bool hasMagic(const void* data, size_t size) {
+    return size >= sizeof(FILE_MAGIC) && std::memcmp(data, FILE_MAGIC, sizeof(FILE_MAGIC)) == 0;
+}
+} // namespace
+
+MapData::MapData()
+    : mapping(nullptr), mappingSize(0), image(nullptr), imageSize(0), header(nullptr), spawnCells(nullptr),
+      symbols(nullptr), tiles(nullptr), directionMasks(nullptr) {}
+
+MapData::~MapData() {
+#ifdef PACMANGAME_MAPDATA_MMAP
+    if (mapping) {
+        munmap(mapping, mappingSize);
+    }
+#endif
+}
+
+void MapData::parseText(const char* text, size_t size) {
+    // Lines as std::getline splits them: no empty line after a final '\n', '\r' stays part of the line
+    std::vector<std::pair<size_t, size_t>> lines; // (start, length)
+    for (size_t start = 0; start < size;) {
+        const void* newline = std::memchr(text + start, '\n', size - start);
+        size_t length =
+            newline ? static_cast<size_t>(static_cast<const char*>(newline) - (text + start)) : size - start;
+        lines.push_back({start, length});
+        start += length + 1;
+    }
+
+    int height = static_cast<int>(lines.size());
+    int width = lines.empty() ? 0 : static_cast<int>(lines[0].second);
+
+    // Short lines are padded with empty cells
+    auto symbolAt = [&](int col, int row) {
+        const auto& [start, length] = lines[row];
+        return static_cast<size_t>(col) < length ? text[start + col] : '*';
+    };
+
+    Header counts = {};
+    TileGrid grid;
+    grid.reset(width, height);
+    for (int row = 0; row < height; row++) {
+        for (int col = 0; col < width; col++) {
+            char symbol = symbolAt(col, row);
+            grid.addFlags(col, row, tileFlagsFor(symbol));
+
+            counts.spawnCount += createsEntity(symbol) ? 1 : 0;
+            counts.wallCount += symbol == '#' ? 1 : 0;
+            counts.coinCount += symbol == '.' ? 1 : 0;
+            counts.fruitCount += symbol == 'F' ? 1 : 0;
+            counts.ghostCount += isGhost(symbol) ? 1 : 0;
+        }
+    }
+    grid.buildDirectionMasks();
+
+    size_t cells = static_cast<size_t>(width) * height;
+    Layout layout = layoutFor(cells, counts.spawnCount);
+    ownedImage.assign(layout.size / sizeof(uint64_t), 0);
+    auto* bytes = reinterpret_cast<uint8_t*>(ownedImage.data());
+
+    std::memcpy(counts.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+    counts.version = FORMAT_VERSION;
+    counts.width = width;
+    counts.height = height;
+    std::memcpy(bytes, &counts, sizeof(counts));
+
+    auto* spawnTable = reinterpret_cast<uint32_t*>(bytes + layout.spawnOffset);
+    auto* symbolLayer = reinterpret_cast<char*>(bytes + layout.symbolOffset);
+    for (int row = 0; row < height; row++) {
+        for (int col = 0; col < width; col++) {
+            char symbol = symbolAt(col, row);
+            size_t cell = static_cast<size_t>(row) * width + col;
+            symbolLayer[cell] = symbol;
+            if (createsEntity(symbol)) {
+                *spawnTable++ = static_cast<uint32_t>(cell);
+            }
+        }
+    }
+
+    if (cells > 0) {
+        std::memcpy(bytes + layout.tileOffset, grid.getTileData(), cells);
+        std::memcpy(bytes + layout.maskOffset, grid.getDirectionMaskData(), cells * 2 * sizeof(DirectionMask));
+    }
+
+    image = bytes;
+    imageSize = layout.size;
+    attachImage("<map text>");
+}
+
+void MapData::attachImage(const std::string& filename) {
+    const std::string error = "ERROR: Invalid compiled map file: " + filename;
+
+    if (imageSize < sizeof(Header) || !hasMagic(image, imageSize)) {
+        throw std::runtime_error(error);
+    }
+    header = reinterpret_cast<const Header*>(image);
+    if (header->version != FORMAT_VERSION || header->width < 0 || header->height < 0) {
+        throw std::runtime_error(error + " (unsupported version or dimensions)");
+    }
+
+    // Every count is bounded by the mapped bytes before it sizes anything: a corrupt header must
+    // fail here, not as a huge reserve() or an out-of-bounds section pointer
+    size_t cells = static_cast<size_t>(header->width) * static_cast<size_t>(header->height);
+    size_t sectionBytes = imageSize - align8(sizeof(Header));
+    if (header->spawnCount > cells || cells > sectionBytes / (2 + 2 * sizeof(DirectionMask)) ||
+        header->spawnCount > sectionBytes / sizeof(uint32_t)) {
+        throw std::runtime_error(error + " (truncated)");
+    }
+    Layout layout = layoutFor(cells, header->spawnCount);
+    if (layout.size != imageSize) {
+        throw std::runtime_error(error + " (truncated)");
+    }
+
+    // Entity counts size World's vectors: each one is a subset of the spawn table
+    uint64_t entityCount = uint64_t(header->wallCount) + header->coinCount + header->fruitCount + header->ghostCount;
+    if (entityCount > header->spawnCount) {
+        throw std::runtime_error(error + " (entity counts exceed the spawn table)");
+    }
+
+    spawnCells = reinterpret_cast<const uint32_t*>(image + layout.spawnOffset);
+    symbols = reinterpret_cast<const char*>(image + layout.symbolOffset);
+    tiles = image + layout.tileOffset;
+    directionMasks = reinterpret_cast<const DirectionMask*>(image + layout.maskOffset);
+
+    // The spawn table indexes per-cell arrays: the only section that is checked entry by entry.
+    // Its symbols must reproduce the header counts.
+    Header counts = {};
+    for (size_t i = 0; i < header->spawnCount; i++) {
+        if (spawnCells[i] >= cells) {
+            throw std::runtime_error(error + " (spawn cell outside the map)");
+        }
+        char symbol = symbols[spawnCells[i]];
+        counts.wallCount += symbol == '#' ? 1 : 0;
+        counts.coinCount += symbol == '.' ? 1 : 0;
+        counts.fruitCount += symbol == 'F' ? 1 : 0;
+        counts.ghostCount += isGhost(symbol) ? 1 : 0;
+    }
+    if (counts.wallCount != header->wallCount || counts.coinCount != header->coinCount ||
+        counts.fruitCount != header->fruitCount || counts.ghostCount != header->ghostCount) {
+        throw std::runtime_error(error + " (entity counts don't match the spawn table)");
+    }
+}
+
+std::shared_ptr<const MapData> MapData::load(const std::string& filename) {
+    std::shared_ptr<MapData> map(new MapData());
+
+#ifdef PACMANGAME_MAPDATA_MMAP
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("ERROR: Cannot open map file: " + filename);
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        throw std::runtime_error("ERROR: Cannot open map file: " + filename);
+    }
+
+    size_t size = static_cast<size_t>(info.st_size);
+    void* data = size > 0 ? mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0) : nullptr;
+    close(fd);
+    if (data == MAP_FAILED) {
+        throw std::runtime_error("ERROR: Cannot map map file: " + filename);
+    }
+    map->mapping = data;
+    map->mappingSize = size;
+
+    if (hasMagic(data, size)) {
+        map->image = static_cast<const uint8_t*>(data);
+        map->imageSize = size;
+        map->attachImage(filename);
+    } else {
+        // ASCII source: parse straight from the mapping, then drop it
+        map->parseText(static_cast<const char*>(data), size);
+        if (data) {
+            munmap(data, size);
+        }
+        map->mapping = nullptr;
+        map->mappingSize = 0;
+    }
+#else
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("ERROR: Cannot open map file: " + filename);
+    }
+    std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    if (hasMagic(contents.data(), contents.size())) {
+        map->ownedImage.assign(align8(contents.size()) / sizeof(uint64_t), 0);
+        std::memcpy(map->ownedImage.data(), contents.data(), contents.size());
+        map->image = reinterpret_cast<const uint8_t*>(map->ownedImage.data());
+        map->imageSize = contents.size();
+        map->attachImage(filename);
+    } else {
+        map->parseText(contents.data(), contents.size());
+    }
+#endif
+
+    return map;
+}
+
+std::shared_ptr<const MapData> MapData::fromText(const std::string& text) {
+    std::shared_ptr<MapData> map(new MapData());
+    map->parseText(text.data(), text.size());
+    return map;
+}
+
+void MapData::save(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("ERROR: Cannot write map file: " + filename);
+    }
+    file.write(reinterpret_cast<const char*>(image), static_cast<std::streamsize>(imageSize));
+    if (!file) {
+        throw std::runtime_error("ERROR: Cannot write map file: " + filename);
+    }
+}
+
+void MapData::compile(const std::string& sourceFile, const std::string& outputFile) {
+    load(sourceFile)->save(outputFile);
+}
+
+std::pair<int, int> MapData::readDimensions(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return {0, 0};
+    }
+
+    Header compiled;
+    if (file.read(reinterpret_cast<char*>(&compiled), sizeof(compiled)) && hasMagic(&compiled, sizeof(compiled))) {
+        if (compiled.version != FORMAT_VERSION) {
+            return {0, 0};
+        }
+        return {compiled.width, compiled.height};
+    }
+
+    file.clear();
+    file.seekg(0);
+    std::string line;
+    int width = 0;
+    int height = 0;
+    while (std::getline(file, line)) {
+        if (height == 0) {
+            width = static_cast<int>(line.length());
+        }
+        height++;
+    }
+    return {width, height};
+}
+
+bool MapData::isCompiled(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    char magic[sizeof(FILE_MAGIC)];
+    return file.read(magic, sizeof(magic)) && hasMagic(magic, sizeof(magic));
+}
+} // namespace logic
@@ -0,0 +1,130 @@
+#include "logic/world/TileGrid.h"
+#include <algorithm>
+#include <cmath>
+
+namespace logic {
+TileGrid::TileGrid() : width(0), height(0), cellWidth(0.0f), cellHeight(0.0f) {}
+
+void TileGrid::reset(int newWidth, int newHeight) {
+    width = newWidth;
+    height = newHeight;
+    cellWidth = width > 0 ? 2.0f / width : 0.0f;
+    cellHeight = height > 0 ? 2.0f / height : 0.0f;
+    tiles.assign(static_cast<size_t>(width) * height, 0);
+    ghostDirectionMasks.clear();
+}
+
+void TileGrid::clear() { reset(0, 0); }
+
+void TileGrid::assign(int newWidth, int newHeight, const uint8_t* newTiles, const DirectionMask* newDirectionMasks) {
+    reset(newWidth, newHeight);
+    tiles.assign(newTiles, newTiles + tiles.size());
+    ghostDirectionMasks.assign(newDirectionMasks, newDirectionMasks + tiles.size() * 2);
+}
+
+void TileGrid::addFlags(int col, int row, uint8_t flags) {
+    if (contains(col, row)) {
+        tiles[static_cast<size_t>(row) * width + col] |= flags;
+    }
+}
+
+uint8_t TileGrid::getFlags(int col, int row) const {
+    if (!contains(col, row)) {
+        return 0;
+    }
+    return tiles[static_cast<size_t>(row) * width + col];
+}
+
+TileGrid::CellRange TileGrid::getOverlappedCells(float left, float right, float top, float bottom) const {
+    if (tiles.empty()) {
+        return {0, -1, 0, -1};
+    }
+
+    // ceil - 1 on the low edge: an edge lying exactly on a cell border still touches the previous cell
+    CellRange range;
+    range.minCol = std::max(0, static_cast<int>(std::ceil((left + 1.0f) / cellWidth)) - 1);
+    range.maxCol = std::min(width - 1, static_cast<int>(std::floor((right + 1.0f) / cellWidth)));
+    range.minRow = std::max(0, static_cast<int>(std::ceil((top + 1.0f) / cellHeight)) - 1);
+    range.maxRow = std::min(height - 1, static_cast<int>(std::floor((bottom + 1.0f) / cellHeight)));
+    return range;
+}
+
+bool TileGrid::overlaps(float left, float right, float top, float bottom, uint8_t flagMask) const {
+    CellRange range = getOverlappedCells(left, right, top, bottom);
+
+    for (int row = range.minRow; row <= range.maxRow; row++) {
+        const uint8_t* rowTiles = &tiles[static_cast<size_t>(row) * width];
+        for (int col = range.minCol; col <= range.maxCol; col++) {
+            if (rowTiles[col] & flagMask) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void TileGrid::buildDirectionMasks() {
+    ghostDirectionMasks.assign(tiles.size() * 2, 0);
+
+    for (int row = 0; row < height; row++) {
+        for (int col = 0; col < width; col++) {
+            DirectionMask throughDoors = 0;
+            DirectionMask doorsBlock = 0;
+
+            for (Direction dir : MOVE_DIRECTIONS) {
+                int neighbourCol = col;
+                int neighbourRow = row;
+
+                switch (dir) {
+                case Direction::LEFT:
+                    neighbourCol--;
+                    break;
+                case Direction::RIGHT:
+                    neighbourCol++;
+                    break;
+                case Direction::UP:
+                    neighbourRow--;
+                    break;
+                case Direction::DOWN:
+                    neighbourRow++;
+                    break;
+                case Direction::NONE:
+                    break;
+                }
+
+                uint8_t flags = getFlags(neighbourCol, neighbourRow);
+                if (flags & (WALL | NO_ENTRY)) {
+                    continue;
+                }
+
+                throughDoors |= directionBit(dir);
+                if (!(flags & DOOR)) {
+                    doorsBlock |= directionBit(dir);
+                }
+            }
+
+            size_t cell = static_cast<size_t>(row) * width + col;
+            ghostDirectionMasks[cell * 2] = throughDoors;
+            ghostDirectionMasks[cell * 2 + 1] = doorsBlock;
+        }
+    }
+}
+
+uint8_t TileGrid::noEntryFlagFor(GhostType type) {
+    switch (type) {
+    case GhostType::RED:
+        return NO_ENTRY_RED;
+    case GhostType::PINK:
+        return NO_ENTRY_PINK;
+    case GhostType::BLUE:
+        return NO_ENTRY_BLUE;
+    case GhostType::ORANGE:
+        return NO_ENTRY_ORANGE;
+    }
+    return NO_ENTRY_ALL;
+}
+
+int TileGrid::columnAt(float x) const { return static_cast<int>(std::floor((x + 1.0f) / cellWidth)); }
+
+int TileGrid::rowAt(float y) const { return static_cast<int>(std::floor((y + 1.0f) / cellHeight)); }
+} // namespace logic
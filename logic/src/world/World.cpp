@@ -4,14 +4,22 @@
 #include "logic/entities/GhostModel.h"
 #include "logic/entities/PacManModel.h"
 #include "logic/entities/WallModel.h"
+#include "logic/utils/BoxKernel.h"
 #include "logic/utils/Random.h"
+#include "logic/world/MapCache.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
 #include <vector>
 
 namespace logic {
 World::World()
-    : factory(nullptr), pacman(nullptr), coinsCollected(0), pacmanSpawnX(0.0f), pacmanSpawnY(0.0f),
-      hasJustRespawned(false), fearModeActive(false), fearModeTimer(0.0f), currentLevel(1), baseGhostSpeed(0.5f),
-      baseFearDuration(7.0f) {}
+    : factory(nullptr), pacman(nullptr), pacmanFieldCell(-1), pacmanSpawnX(0.0f), pacmanSpawnY(0.0f),
+      hasJustRespawned(false), fearModeActive(false), fearModeTimer(0.0f), currentLevel(1), deaths(0),
+      baseGhostSpeed(0.5f), baseFearDuration(7.0f), seed(Random::randomSeed()), simulationTime(0.0),
+      pristineState() {}
 
 World::~World() {
     scoreSubject.detach(&score);
@@ -34,6 +42,7 @@ World::~World() {
 }
 
 void World::update(float deltaTime) {
+    storePreviousPositions();
     score.update(deltaTime);
 
     if (fearModeActive) {
@@ -49,6 +58,7 @@ void World::update(float deltaTime) {
             for (auto& ghost : ghosts) {
                 ghost->exitFearMode();
             }
+            scheduleAllGhostDecisions(); // Speed and state changed
         }
     }
 
@@ -59,711 +69,1162 @@ void World::update(float deltaTime) {
         if (!pacman->getIsDying()) {
             resetAfterDeath();
         }
+        simulationTime += deltaTime;
+        return;
+    }
+
+    updatePacManDistanceField();
+
+    // Typed storage only: static entities (walls, coins, doors, ...) have no per-frame behaviour.
+    // Ghosts move first so PacMan resolves contacts against their positions for this frame.
+    for (size_t i = 0; i < ghosts.size(); i++) {
+        GhostModel& ghost = *ghosts[i];
+        if (ghostDecisionTimes[i] <= simulationTime) {
+            runGhostDecision(ghost);
+            double delay = getNextDecisionDelay(ghost);
+            ghostDecisionTimes[i] = delay >= 0.0 ? simulationTime + delay : std::numeric_limits<double>::infinity();
+        }
+
+        GhostState state = ghost.getState();
+        Direction direction = ghost.getCurrentDirection();
+        bool exited = ghost.hasExited();
+
+        updateGhost(ghost, deltaTime);
 
-        renderInOrder();
+        // State transitions and collision responses invalidate the pending decision time
+        if (ghost.getState() != state || ghost.getCurrentDirection() != direction || ghost.hasExited() != exited) {
+            ghostDecisionTimes[i] = simulationTime;
+        }
+    }
+
+    if (pacman) {
+        updatePacMan(*pacman, deltaTime);
+    }
+    simulationTime += deltaTime;
+}
+
+void World::updatePacManDistanceField() {
+    if (!pacman) {
         return;
     }
 
-    for (const auto& entity : entities) {
-        if (entity->isPacMan()) {
-            auto pm = std::dynamic_pointer_cast<PacManModel>(entity);
+    int col = tileGrid.columnAt(pacman->getX());
+    int row = tileGrid.rowAt(pacman->getY());
 
-            // Apply buffered input when valid (responsive controls)
-            Direction nextDir = pm->getNextDirection();
-            if (nextDir != Direction::NONE && isDirectionValid(nextDir)) {
-                pm->applyNextDirection();
-            }
+    // Outside the grid (tunnel wraparound): keep the last field
+    if (!tileGrid.contains(col, row) || tileGrid.cellIndex(col, row) == pacmanFieldCell) {
+        return;
+    }
 
-            // Predictive collision: test new position before applying
-            float oldX = pm->getX();
-            float oldY = pm->getY();
+    // Ghosts on the board never pass doors, so distances follow the corridors only
+    pacmanDistanceField.compute(tileGrid, col, row, true);
+    pacmanFieldCell = tileGrid.cellIndex(col, row);
+}
 
-            pm->update(deltaTime);
+bool World::predictPacManCell(int& col, int& row) const {
+    if (!pacman) {
+        return false;
+    }
 
-            float newX = pm->getX();
-            float newY = pm->getY();
+    int pacmanCol = tileGrid.columnAt(pacman->getX());
+    int pacmanRow = tileGrid.rowAt(pacman->getY());
+    if (!tileGrid.contains(pacmanCol, pacmanRow)) {
+        return false;
+    }
 
-            // Tunnel wraparound at world edges
-            const float WORLD_LEFT = -1.0f;
-            const float WORLD_RIGHT = 1.0f;
-            const float TUNNEL_THRESHOLD = 0.02f; // Prevents instant re-wrap
+    int stepCol = 0;
+    int stepRow = 0;
+    switch (pacman->getCurrentDirection()) {
+    case Direction::UP:
+        stepRow = -1;
+        break;
+    case Direction::DOWN:
+        stepRow = 1;
+        break;
+    case Direction::LEFT:
+        stepCol = -1;
+        break;
+    case Direction::RIGHT:
+        stepCol = 1;
+        break;
+    case Direction::NONE:
+        break;
+    }
 
-            if (newX < WORLD_LEFT - TUNNEL_THRESHOLD) {
-                pm->setPosition(WORLD_RIGHT - TUNNEL_THRESHOLD, newY);
-            } else if (newX > WORLD_RIGHT + TUNNEL_THRESHOLD) {
-                pm->setPosition(WORLD_LEFT + TUNNEL_THRESHOLD, newY);
-            }
+    for (int ahead = 4; ahead > 0; ahead--) {
+        col = pacmanCol + stepCol * ahead;
+        row = pacmanRow + stepRow * ahead;
+        if (ghostPathfinder.isConnected(col, row, pacmanCol, pacmanRow)) {
+            return true;
+        }
+    }
 
-            bool collided = false;
+    col = pacmanCol;
+    row = pacmanRow;
+    return true;
+}
 
-            for (auto& wall : walls) {
-                if (pm->intersects(*wall)) {
-                    collided = true;
-                    break;
-                }
-            }
+DirectionDistances World::getGhostTargetDistances(const GhostModel& ghost) {
+    int col = tileGrid.columnAt(ghost.getX());
+    int row = tileGrid.rowAt(ghost.getY());
 
-            if (!collided) {
-                for (auto& door : doors) {
-                    if (pm->intersects(*door)) {
-                        collided = true;
-                        break;
-                    }
-                }
-            }
+    int targetCol = 0;
+    int targetRow = 0;
+    bool predicts = ghost.getType() == GhostType::PINK || ghost.getType() == GhostType::BLUE;
+    if (ghost.getState() == GhostState::CHASING && predicts && predictPacManCell(targetCol, targetRow)) {
+        return ghostPathfinder.getNeighbourDistances(col, row, targetCol, targetRow);
+    }
+    return pacmanDistanceField.getNeighbours(col, row);
+}
 
-            if (collided) {
-                pm->setPosition(oldX, oldY);
-                pm->stopMovement();
-            }
+void World::buildGhostHomeFields() {
+    for (const auto& ghost : ghosts) {
+        int col = tileGrid.columnAt(ghost->getEatenRespawnX());
+        int row = tileGrid.rowAt(ghost->getEatenRespawnY());
+        if (!tileGrid.contains(col, row)) {
+            continue;
+        }
 
-            for (auto& ghost : ghosts) {
-                if (ghost->getState() == GhostState::CHASING && pm->intersects(*ghost)) {
-                    handlePacManDeath();
-                    return;
-                }
+        int cell = tileGrid.cellIndex(col, row);
+        if (std::find(ghostHomeCells.begin(), ghostHomeCells.end(), cell) != ghostHomeCells.end()) {
+            continue;
+        }
+
+        // Eyes pass through doors (the ghost house is behind one)
+        ghostHomeFields.emplace_back();
+        ghostHomeFields.back().compute(tileGrid, col, row, false);
+        ghostHomeCells.push_back(cell);
+    }
+}
 
-                if (ghost->getState() == GhostState::FEAR && pm->intersects(*ghost)) {
-                    ghost->getEaten();
+const DistanceField* World::getGhostHomeField(const GhostModel& ghost) const {
+    int col = tileGrid.columnAt(ghost.getEatenRespawnX());
+    int row = tileGrid.rowAt(ghost.getEatenRespawnY());
+    if (!tileGrid.contains(col, row)) {
+        return nullptr;
+    }
 
-                    score.setEvent(ScoreEvent::GHOST_EATEN);
-                    scoreSubject.notify();
-                }
+    // Few distinct homes per map (usually one): linear scan
+    int cell = tileGrid.cellIndex(col, row);
+    for (size_t i = 0; i < ghostHomeCells.size(); i++) {
+        if (ghostHomeCells[i] == cell) {
+            return &ghostHomeFields[i];
+        }
+    }
+    return nullptr;
+}
+
+bool World::returnGhostHome(GhostModel& ghost, float deltaTime) {
+    const DistanceField* field = getGhostHomeField(ghost);
+    if (!field) {
+        return false;
+    }
+
+    const float EPSILON = 1e-5f;
+    float cellWidth = tileGrid.getCellWidth();
+    float cellHeight = tileGrid.getCellHeight();
+    float remaining = ghost.getSpeed() * deltaTime;
+
+    // Each pass moves to the next waypoint (own cell center, then neighbour centers); bounded for safety
+    for (int pass = 0; pass < 8 && remaining > EPSILON; pass++) {
+        int col = tileGrid.columnAt(ghost.getX());
+        int row = tileGrid.rowAt(ghost.getY());
+        uint16_t distance = field->get(col, row);
+        if (distance == DistanceField::UNREACHABLE) {
+            return false;
+        }
+
+        float centerX = tileGrid.getCellCenterX(col);
+        float centerY = tileGrid.getCellCenterY(row);
+        float offsetX = ghost.getX() - centerX;
+        float offsetY = ghost.getY() - centerY;
+        Direction direction = ghost.getCurrentDirection();
+
+        float targetX = centerX;
+        float targetY = centerY;
+
+        // The home cell itself is always enterable (a spawn cell may carry a NoEntry barrier against other ghosts)
+        DirectionMask open = tileGrid.getGhostDirectionMask(col, row, false);
+        DirectionDistances neighbours = field->getNeighbours(col, row);
+        DirectionMask enterable = 0;
+        for (int i = 0; i < 4; i++) {
+            if ((open & directionBit(MOVE_DIRECTIONS[i])) || neighbours[i] == 0) {
+                enterable |= directionBit(MOVE_DIRECTIONS[i]);
             }
+        }
 
-            for (auto& coin : coins) {
-                if (!coin->isCollected() && pm->intersects(*coin)) {
-                    coin->collect();
-                    coinsCollected++;
+        if (std::abs(offsetX) <= EPSILON && std::abs(offsetY) <= EPSILON) {
+            if (distance == 0) {
+                ghost.arriveAtSpawn();
+                return true;
+            }
 
-                    score.setEvent(ScoreEvent::COIN_COLLECTED);
-                    scoreSubject.notify();
+            // At a cell center: step to the enterable neighbour closest to home
+            direction = Direction::NONE;
+            for (int i = 0; i < 4; i++) {
+                if ((enterable & directionBit(MOVE_DIRECTIONS[i])) && neighbours[i] < distance) {
+                    distance = neighbours[i];
+                    direction = MOVE_DIRECTIONS[i];
                 }
             }
+            if (direction == Direction::NONE) {
+                return false;
+            }
+            ghost.setDirection(direction);
+        }
+
+        // Already past the center in the travel direction: head on to the next center (if open)
+        bool pastCenter = (direction == Direction::LEFT && offsetX <= EPSILON && std::abs(offsetY) <= EPSILON) ||
+                          (direction == Direction::RIGHT && offsetX >= -EPSILON && std::abs(offsetY) <= EPSILON) ||
+                          (direction == Direction::UP && offsetY <= EPSILON && std::abs(offsetX) <= EPSILON) ||
+                          (direction == Direction::DOWN && offsetY >= -EPSILON && std::abs(offsetX) <= EPSILON);
+        if (pastCenter && (enterable & directionBit(direction))) {
+            switch (direction) {
+            case Direction::LEFT:
+                targetX -= cellWidth;
+                break;
+            case Direction::RIGHT:
+                targetX += cellWidth;
+                break;
+            case Direction::UP:
+                targetY -= cellHeight;
+                break;
+            case Direction::DOWN:
+                targetY += cellHeight;
+                break;
+            case Direction::NONE:
+                break;
+            }
+        }
 
-            for (auto& fruit : fruits) {
-                if (!fruit->isCollected() && pm->intersects(*fruit)) {
-                    fruit->collect();
+        // Straight (or L-shaped when caught off the center line) move toward the waypoint
+        float newX = ghost.getX();
+        float newY = ghost.getY();
+        float stepX = std::min(std::abs(targetX - newX), remaining);
+        newX += targetX > newX ? stepX : -stepX;
+        remaining -= stepX;
+        float stepY = std::min(std::abs(targetY - newY), remaining);
+        newY += targetY > newY ? stepY : -stepY;
+        remaining -= stepY;
+
+        if (stepX > EPSILON) {
+            ghost.setDirection(targetX > ghost.getX() ? Direction::RIGHT : Direction::LEFT);
+        } else if (stepY > EPSILON) {
+            ghost.setDirection(targetY > ghost.getY() ? Direction::DOWN : Direction::UP);
+        }
 
-                    score.setEvent(ScoreEvent::FRUIT_EATEN);
-                    scoreSubject.notify();
+        // Land exactly on waypoints so center tests stay exact
+        if (std::abs(newX - targetX) <= EPSILON && std::abs(newY - targetY) <= EPSILON) {
+            newX = targetX;
+            newY = targetY;
+        }
+        ghost.setPosition(newX, newY);
+    }
+    return true;
+}
 
-                    activateFearMode();
-                }
-            }
-        } else if (entity->isGhost()) {
-            auto ghost = std::dynamic_pointer_cast<GhostModel>(entity);
+void World::updatePacMan(PacManModel& pm, float deltaTime) {
+    // Apply buffered input when valid (responsive controls)
+    Direction nextDir = pm.getNextDirection();
+    if (nextDir != Direction::NONE && isDirectionValid(nextDir)) {
+        pm.applyNextDirection();
+    }
 
-            if ((ghost->getState() == GhostState::CHASING || ghost->getState() == GhostState::FEAR) &&
-                ghost->getCurrentDirection() == Direction::NONE) {
+    // Predictive collision: test new position before applying
+    float oldX = pm.getX();
+    float oldY = pm.getY();
 
-                if (ghost->getType() == GhostType::RED) {
-                    ghost->setDirection(Direction::LEFT);
-                } else {
-                    Direction viableDir = getViableDirectionForGhost(ghost);
-                    ghost->setDirection(viableDir);
-                }
-            }
+    pm.update(deltaTime);
 
-            if ((ghost->getState() == GhostState::CHASING || ghost->getState() == GhostState::FEAR) &&
-                ghost->getCurrentDirection() != Direction::NONE) {
+    float newX = pm.getX();
+    float newY = pm.getY();
 
-                std::vector<Direction> viableDirections = getViableDirectionsForGhost(ghost);
+    // Tunnel wraparound at world edges
+    const float WORLD_LEFT = -1.0f;
+    const float WORLD_RIGHT = 1.0f;
+    const float TUNNEL_THRESHOLD = 0.02f; // Prevents instant re-wrap
 
-                if (ghost->needsDirectionDecision(viableDirections)) {
-                    float pacmanX = pacman ? pacman->getX() : 0.0f;
-                    float pacmanY = pacman ? pacman->getY() : 0.0f;
-                    Direction pacmanDir = pacman ? pacman->getCurrentDirection() : Direction::NONE;
-                    ghost->makeDirectionDecision(viableDirections, pacmanX, pacmanY, pacmanDir);
-                }
-            }
+    if (newX < WORLD_LEFT - TUNNEL_THRESHOLD) {
+        pm.teleport(WORLD_RIGHT - TUNNEL_THRESHOLD, newY);
+    } else if (newX > WORLD_RIGHT + TUNNEL_THRESHOLD) {
+        pm.teleport(WORLD_LEFT + TUNNEL_THRESHOLD, newY);
+    }
+
+    bool collided = overlapsTiles(pm, 0.0f, 0.0f, TileGrid::WALL | TileGrid::DOOR);
 
-            float oldX = ghost->getX();
-            float oldY = ghost->getY();
+    if (collided) {
+        pm.setPosition(oldX, oldY);
+        pm.stopMovement();
+    }
 
-            ghost->update(deltaTime);
+    // One batched box test against the ghost columns (ghost i in slot i, PacMan's own slot excluded)
+    BoxColumns ghostBoxes = {movingEntities.getXData(), movingEntities.getYData(), movingEntities.getWidthData(),
+                             movingEntities.getHeightData(), ghosts.size()};
+    const uint8_t* ghostState = movingEntities.getStateData();
 
-            if (ghost->getState() == GhostState::EATEN) {
+    if (intersectBoxes(pm.getX(), pm.getY(), pm.getWidth(), pm.getHeight(), ghostBoxes, ghostContacts.data()) > 0) {
+        for (size_t i = 0; i < ghosts.size(); i++) {
+            if (!ghostContacts.test(i)) {
                 continue;
             }
 
-            bool wallCollision = false;
-            for (auto& wall : walls) {
-                if (ghost->intersects(*wall)) {
-                    wallCollision = true;
-                    break;
-                }
+            GhostState state = static_cast<GhostState>(ghostState[i]);
+            if (state == GhostState::CHASING) {
+                handlePacManDeath();
+                return;
+            }
+            if (state != GhostState::FEAR) {
+                continue;
             }
 
-            bool doorCollision = false;
-            for (auto& door : doors) {
-                if (ghost->intersects(*door)) {
-                    if (ghost->getState() == GhostState::EATEN) {
-                        continue;
-                    }
+            ghosts[i]->getEaten();
 
-                    if (ghost->getState() == GhostState::EXITING_SPAWN) {
-                        ghost->markAsExited();
-                    } else if (ghost->hasExited()) {
-                        doorCollision = true;
-                        break;
-                    } else {
-                        ghost->markAsExited();
-                    }
-                }
+            score.setEvent(ScoreEvent::GHOST_EATEN);
+            scoreSubject.notify();
+        }
+    }
+
+    collectPickups(pm);
+}
+
+void World::steerAlongIntersectionGraph(GhostModel& ghost) {
+    int col = tileGrid.columnAt(ghost.getX());
+    int row = tileGrid.rowAt(ghost.getY());
+    Direction direction = ghost.getCurrentDirection();
+    int node = intersectionGraph.getNodeAt(col, row);
+
+    // A decision only holds while the ghost stays in that node's cell
+    if (ghost.getDecisionNode() != node) {
+        ghost.setDecisionNode(IntersectionGraph::NO_NODE);
+    }
+
+    if (node == IntersectionGraph::NO_NODE) {
+        DirectionMask exits = intersectionGraph.getExits(col, row);
+        if (exits == 0 || (exits & directionBit(direction))) {
+            return;
+        }
+
+        // Corner: the other exit lies on the perpendicular axis, taken once the ghost is aligned with it
+        DirectionMask verticalAxis = directionBit(Direction::UP) | directionBit(Direction::DOWN);
+        DirectionMask perpendicular = (directionBit(direction) & verticalAxis) ? ~verticalAxis : verticalAxis;
+        DirectionMask turn = getViableDirectionMask(ghost) & exits & perpendicular;
+        for (Direction dir : MOVE_DIRECTIONS) {
+            if (turn & directionBit(dir)) {
+                ghost.setDirection(dir);
+                return;
             }
+        }
+        return;
+    }
 
-            bool noEntryCollision = false;
-            for (auto& noEntry : noEntries) {
-                if (ghost->intersects(*noEntry) && noEntry->blocksGhostType(ghost->getType())) {
-                    noEntryCollision = true;
-                    break;
-                }
+    if (ghost.getDecisionNode() == node) {
+        return;
+    }
+
+    // Decide once per visit, on the first frame the ghost is centered in the node's cell
+    float toleranceX = (tileGrid.getCellWidth() - ghost.getWidth()) / 2.0f;
+    float toleranceY = (tileGrid.getCellHeight() - ghost.getHeight()) / 2.0f;
+    if (std::abs(ghost.getX() - tileGrid.getCellCenterX(col)) > toleranceX ||
+        std::abs(ghost.getY() - tileGrid.getCellCenterY(row)) > toleranceY) {
+        return;
+    }
+    DirectionMask exits = intersectionGraph.getNode(node).exits;
+    ghost.setDecisionNode(node);
+
+    // Dead end: the only exit is the way back
+    if (directionCount(exits) == 1) {
+        for (Direction dir : MOVE_DIRECTIONS) {
+            if (exits & directionBit(dir)) {
+                ghost.setDirection(dir);
             }
+        }
+        return;
+    }
 
-            if (wallCollision || doorCollision || noEntryCollision) {
-                ghost->setPosition(oldX, oldY);
-
-                // Hardcoded spawn exit collision responses
-                if (ghost->getState() == GhostState::EXITING_SPAWN) {
-                    if (ghost->getType() == GhostType::ORANGE && ghost->getCurrentDirection() == Direction::LEFT) {
-                        ghost->setDirection(Direction::UP);
-                    } else if (ghost->getType() == GhostType::BLUE && ghost->getCurrentDirection() == Direction::RIGHT) {
-                        ghost->setDirection(Direction::UP);
-                    } else if (ghost->getCurrentDirection() == Direction::UP) {
-                        if (ghost->getType() == GhostType::BLUE) {
-                            ghost->setDirection(Direction::RIGHT);
-                        } else {
-                            ghost->setDirection(Direction::LEFT);
-                        }
-                    } else {
-                        ghost->stopMovement();
-                    }
+    if (ghost.needsDirectionDecision(exits)) {
+        decideGhostDirection(ghost, exits);
+    }
+}
+
+void World::decideGhostDirection(GhostModel& ghost, DirectionMask viableDirections) {
+    float pacmanX = pacman ? pacman->getX() : 0.0f;
+    float pacmanY = pacman ? pacman->getY() : 0.0f;
+    Direction pacmanDir = pacman ? pacman->getCurrentDirection() : Direction::NONE;
+    DirectionDistances distances = getGhostTargetDistances(ghost);
+    ghost.makeDirectionDecision(viableDirections, distances, pacmanX, pacmanY, pacmanDir);
+}
+
+void World::runGhostDecision(GhostModel& ghost) {
+    if ((ghost.getState() == GhostState::CHASING || ghost.getState() == GhostState::FEAR) &&
+        ghost.getCurrentDirection() == Direction::NONE) {
+
+        if (ghost.getType() == GhostType::RED) {
+            ghost.setDirection(Direction::LEFT);
+        } else {
+            Direction viableDir = getViableDirectionForGhost(ghost);
+            ghost.setDirection(viableDir);
+        }
+    }
+
+    if ((ghost.getState() == GhostState::CHASING || ghost.getState() == GhostState::FEAR) &&
+        ghost.getCurrentDirection() != Direction::NONE) {
+
+        // Doors are open to ghosts still inside the spawn area, the graph only covers the maze outside
+        if (ghost.hasExited() && !intersectionGraph.isEmpty()) {
+            steerAlongIntersectionGraph(ghost);
+        } else {
+            DirectionMask viableDirections = getViableDirectionMask(ghost);
+
+            if (ghost.needsDirectionDecision(viableDirections)) {
+                decideGhostDirection(ghost, viableDirections);
+            }
+        }
+    }
+}
+
+double World::getNextDecisionDelay(const GhostModel& ghost) const {
+    if (ghost.getState() != GhostState::CHASING && ghost.getState() != GhostState::FEAR) {
+        return -1.0;
+    }
+
+    // Without the graph (or when stopped) every frame may need a decision
+    Direction direction = ghost.getCurrentDirection();
+    if (direction == Direction::NONE || !ghost.hasExited() || intersectionGraph.isEmpty() || ghost.getSpeed() <= 0.0f) {
+        return 0.0;
+    }
+
+    bool horizontal = direction == Direction::LEFT || direction == Direction::RIGHT;
+    int stepCol = direction == Direction::LEFT ? -1 : (direction == Direction::RIGHT ? 1 : 0);
+    int stepRow = direction == Direction::UP ? -1 : (direction == Direction::DOWN ? 1 : 0);
+    float sign = static_cast<float>(stepCol + stepRow);
+    float position = horizontal ? ghost.getX() : ghost.getY();
+    float tolerance = horizontal ? (tileGrid.getCellWidth() - ghost.getWidth()) / 2.0f
+                                 : (tileGrid.getCellHeight() - ghost.getHeight()) / 2.0f;
+
+    // Wake slightly early: float positions drift by far less than this over a corridor
+    const float WAKE_MARGIN = 1e-4f;
+
+    int col = tileGrid.columnAt(ghost.getX());
+    int row = tileGrid.rowAt(ghost.getY());
+    for (bool first = true; tileGrid.contains(col, row); col += stepCol, row += stepRow, first = false) {
+        // Straight corridor cells need no steering; nodes (unless just decided at), bends and walls do
+        int node = intersectionGraph.getNodeAt(col, row);
+        DirectionMask exits = intersectionGraph.getExits(col, row);
+        bool decides = node != IntersectionGraph::NO_NODE ? (!first || ghost.getDecisionNode() != node)
+                                                         : !(exits & directionBit(direction));
+        if (!decides) {
+            continue;
+        }
+
+        // Steering acts once the ghost is within tolerance of the cell center
+        float ahead = sign * ((horizontal ? tileGrid.getCellCenterX(col) : tileGrid.getCellCenterY(row)) - position);
+        if (first && ahead < -tolerance) {
+            continue; // Already past this cell's window
+        }
+
+        float gap = ahead - tolerance - WAKE_MARGIN;
+        return gap > 0.0f ? gap / ghost.getSpeed() : 0.0;
+    }
+    return 0.0;
+}
+
+void World::scheduleAllGhostDecisions() { ghostDecisionTimes.assign(ghosts.size(), simulationTime); }
+
+void World::updateGhost(GhostModel& ghost, float deltaTime) {
+    if (ghost.getState() == GhostState::EATEN && returnGhostHome(ghost, deltaTime)) {
+        return;
+    }
+
+    float oldX = ghost.getX();
+    float oldY = ghost.getY();
+
+    ghost.update(deltaTime);
+
+    if (ghost.getState() == GhostState::EATEN) {
+        return;
+    }
+
+    bool wallCollision = overlapsTiles(ghost, 0.0f, 0.0f, TileGrid::WALL);
+
+    bool doorCollision = false;
+    if (overlapsTiles(ghost, 0.0f, 0.0f, TileGrid::DOOR)) {
+        if (ghost.getState() == GhostState::EXITING_SPAWN) {
+            ghost.markAsExited();
+        } else if (ghost.hasExited()) {
+            doorCollision = true;
+        } else {
+            ghost.markAsExited();
+        }
+    }
+
+    bool noEntryCollision =
+        overlapsTiles(ghost, 0.0f, 0.0f, TileGrid::noEntryFlagFor(ghost.getType()));
+
+    if (wallCollision || doorCollision || noEntryCollision) {
+        ghost.setPosition(oldX, oldY);
+
+        // Hardcoded spawn exit collision responses
+        if (ghost.getState() == GhostState::EXITING_SPAWN) {
+            if (ghost.getType() == GhostType::ORANGE && ghost.getCurrentDirection() == Direction::LEFT) {
+                ghost.setDirection(Direction::UP);
+            } else if (ghost.getType() == GhostType::BLUE && ghost.getCurrentDirection() == Direction::RIGHT) {
+                ghost.setDirection(Direction::UP);
+            } else if (ghost.getCurrentDirection() == Direction::UP) {
+                if (ghost.getType() == GhostType::BLUE) {
+                    ghost.setDirection(Direction::RIGHT);
                 } else {
-                    ghost->stopMovement();
-                    Direction viableDir = getViableDirectionForGhost(ghost);
-                    ghost->setDirection(viableDir);
+                    ghost.setDirection(Direction::LEFT);
                 }
+            } else {
+                ghost.stopMovement();
             }
         } else {
-            entity->update(deltaTime);
+            ghost.stopMovement();
+            Direction viableDir = getViableDirectionForGhost(ghost);
+            ghost.setDirection(viableDir);
         }
     }
-    renderInOrder();
 }
 
 void World::setFactory(AbstractFactory* factory) { this->factory = factory; }
 
 void World::addEntity(std::unique_ptr<EntityModel> entity) { entities.push_back(std::move(entity)); }
 
-void World::loadMap(const std::string& filename) {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        throw std::runtime_error("ERROR: Cannot open map file: " + filename);
-    }
+void World::loadMap(const std::string& filename) { loadMap(*MapCache::getInstance().load(filename)); }
 
+void World::loadMap(const MapData& map) {
     clearWorld();
 
-    std::vector<std::string> mapLines;
-    std::string line;
-    while (std::getline(file, line)) {
-        mapLines.push_back(line);
-    }
-    file.close();
-
-    if (mapLines.empty()) {
+    int width = map.getWidth();
+    int height = map.getHeight();
+    if (width == 0 || height == 0) {
+        snapshot(pristineState);
         return;
     }
 
-    int height = static_cast<int>(mapLines.size());
-    int width = static_cast<int>(mapLines[0].length());
-
     // Convert world space [-1, 1] to grid cells
     float cellWidth = 2.0f / width;
     float cellHeight = 2.0f / height;
 
-    for (int row = 0; row < height; row++) {
-        for (int col = 0; col < width; col++) {
-            char symbol = mapLines[row][col];
-
-            // Center of cell in normalized coordinates
-            float normalizedX = -1.0f + cellWidth / 2.0f + col * cellWidth;
-            float normalizedY = -1.0f + cellHeight / 2.0f + row * cellHeight;
-
-            // ASCII map symbols:
-            // # = wall, C = PacMan, R/P/B/O = ghosts, . = coin, F = fruit
-            // D = door, N = NoEntry barrier, * = empty space
-            switch (symbol) {
-            case '#': {
-                if (factory) {
-                    auto result = factory->createWall(normalizedX, normalizedY, cellWidth, cellHeight);
-
-                    if (auto wallPtr = std::dynamic_pointer_cast<WallModel>(result.model)) {
-                        walls.push_back(wallPtr);
-                    }
+    // Tile flags and direction masks come precomputed with the map
+    tileGrid.assign(width, height, map.getTiles(), map.getDirectionMasks());
+    coinIndexByCell.assign(static_cast<size_t>(width) * height, -1);
+    fruitIndexByCell.assign(static_cast<size_t>(width) * height, -1);
+
+    const MapData::Header& counts = map.getHeader();
+    entities.reserve(counts.spawnCount + counts.ghostCount); // BLUE/ORANGE add a NoEntry barrier each
+    walls.reserve(counts.wallCount);
+    wallViews.reserve(counts.wallCount);
+    coins.reserve(counts.coinCount);
+    coinViews.reserve(counts.coinCount);
+    fruits.reserve(counts.fruitCount);
+    ghosts.reserve(counts.ghostCount);
+    movingEntities.reserve(counts.ghostCount + 1);
+
+    // Only cells that create an entity, in row-major order (same entity order as a full scan)
+    for (size_t spawn = 0; spawn < map.getSpawnCount(); spawn++) {
+        int cell = static_cast<int>(map.getSpawnCell(spawn));
+        int col = cell % width;
+        int row = cell / width;
+        char symbol = map.getSymbol(cell);
+
+        // Center of cell in normalized coordinates
+        float normalizedX = -1.0f + cellWidth / 2.0f + col * cellWidth;
+        float normalizedY = -1.0f + cellHeight / 2.0f + row * cellHeight;
+
+        // ASCII map symbols:
+        // # = wall, C = PacMan, R/P/B/O = ghosts, . = coin, F = fruit
+        // D = door, N = NoEntry barrier, * = empty space
+        switch (symbol) {
+        case '#': {
+            if (factory) {
+                auto result = factory->createWall(arena, normalizedX, normalizedY, cellWidth, cellHeight);
+
+                if (auto wallPtr = std::dynamic_pointer_cast<WallModel>(result.model)) {
+                    walls.push_back(wallPtr);
+                }
 
-                    entities.push_back(result.model);
+                entities.push_back(result.model);
+                if (result.view) {
                     wallViews.push_back(std::move(result.view));
                 }
-                break;
             }
+            break;
+        }
 
-            case 'D': {
-                if (factory) {
-                    auto result = factory->createDoor(normalizedX, normalizedY, cellWidth, cellHeight);
+        case 'D': {
+            if (factory) {
+                auto result = factory->createDoor(arena, normalizedX, normalizedY, cellWidth, cellHeight);
 
-                    if (auto doorPtr = std::dynamic_pointer_cast<DoorModel>(result.model)) {
-                        doors.push_back(doorPtr);
-                    }
+                if (auto doorPtr = std::dynamic_pointer_cast<DoorModel>(result.model)) {
+                    doors.push_back(doorPtr);
+                }
 
-                    entities.push_back(result.model);
+                entities.push_back(result.model);
+                if (result.view) {
                     doorViews.push_back(std::move(result.view));
                 }
-                break;
             }
+            break;
+        }
 
-            case 'C': {
-                if (factory) {
-                    auto result = factory->createPacMan(normalizedX, normalizedY, cellWidth * 0.9f, cellHeight * 0.9f, 0.5f);
-
-                    pacman = std::dynamic_pointer_cast<PacManModel>(result.model);
-                    if (pacman) {
-                        pacman->setCellDimensions(cellWidth, cellHeight);
-                    }
-
-                    pacmanSpawnX = normalizedX;
-                    pacmanSpawnY = normalizedY;
-
-                    entities.push_back(result.model);
-                    pacmanView = std::move(result.view);
-                }
-                break;
-            }
+        case 'C':
+            break; // Created after the ghosts (below)
 
-            case 'R': {
-                if (factory) {
-                    auto result = factory->createGhost(normalizedX, normalizedY, cellWidth * 0.85f, cellHeight * 0.85f,
-                                                       GhostType::RED, 0.0f);
+        case 'R': {
+            if (factory) {
+                auto result = factory->createGhost(arena, movingEntities, normalizedX, normalizedY, cellWidth * 0.85f,
+                                                   cellHeight * 0.85f, GhostType::RED, 0.0f);
 
-                    if (auto ghostPtr = std::dynamic_pointer_cast<GhostModel>(result.model)) {
-                        ghostPtr->setCellDimensions(cellWidth, cellHeight);
-                        ghostPtr->markAsExited(); // RED spawns outside
-                        ghosts.push_back(ghostPtr);
+                if (auto ghostPtr = std::dynamic_pointer_cast<GhostModel>(result.model)) {
+                    ghostPtr->setCellDimensions(cellWidth, cellHeight);
+                    ghostPtr->markAsExited(); // RED spawns outside
+                    ghosts.push_back(ghostPtr);
 
-                        ghostSpawnPositions.push_back({normalizedX, normalizedY});
+                    ghostSpawnPositions.push_back({normalizedX, normalizedY});
 
-                        // Hardcoded: center of spawn room (column 9, row 9)
-                        float eatenSpawnX = -1.0f + cellWidth / 2.0f + 9 * cellWidth;
-                        float eatenSpawnY = -1.0f + cellHeight / 2.0f + 9 * cellHeight;
-                        ghostPtr->setEatenRespawnPosition(eatenSpawnX, eatenSpawnY);
-                    }
+                    // Hardcoded: center of spawn room (column 9, row 9)
+                    float eatenSpawnX = -1.0f + cellWidth / 2.0f + 9 * cellWidth;
+                    float eatenSpawnY = -1.0f + cellHeight / 2.0f + 9 * cellHeight;
+                    ghostPtr->setEatenRespawnPosition(eatenSpawnX, eatenSpawnY);
+                }
 
-                    entities.push_back(result.model);
+                entities.push_back(result.model);
+                if (result.view) {
                     ghostViews.push_back(std::move(result.view));
                 }
-                break;
             }
+            break;
+        }
 
-            case 'P': {
-                if (factory) {
-                    auto result = factory->createGhost(normalizedX, normalizedY, cellWidth * 0.85f, cellHeight * 0.85f,
-                                                       GhostType::PINK, 0.0f);
+        case 'P': {
+            if (factory) {
+                auto result = factory->createGhost(arena, movingEntities, normalizedX, normalizedY, cellWidth * 0.85f,
+                                                   cellHeight * 0.85f, GhostType::PINK, 0.0f);
 
-                    if (auto ghostPtr = std::dynamic_pointer_cast<GhostModel>(result.model)) {
-                        ghostPtr->setCellDimensions(cellWidth, cellHeight);
-                        ghosts.push_back(ghostPtr);
+                if (auto ghostPtr = std::dynamic_pointer_cast<GhostModel>(result.model)) {
+                    ghostPtr->setCellDimensions(cellWidth, cellHeight);
+                    ghosts.push_back(ghostPtr);
 
-                        ghostSpawnPositions.push_back({normalizedX, normalizedY});
+                    ghostSpawnPositions.push_back({normalizedX, normalizedY});
 
-                        float centerSpawnX = -1.0f + cellWidth / 2.0f + 9 * cellWidth;
-                        float centerSpawnY = -1.0f + cellHeight / 2.0f + 9 * cellHeight;
-                        ghostPtr->setEatenRespawnPosition(centerSpawnX, centerSpawnY);
-                    }
+                    float centerSpawnX = -1.0f + cellWidth / 2.0f + 9 * cellWidth;
+                    float centerSpawnY = -1.0f + cellHeight / 2.0f + 9 * cellHeight;
+                    ghostPtr->setEatenRespawnPosition(centerSpawnX, centerSpawnY);
+                }
 
-                    entities.push_back(result.model);
+                entities.push_back(result.model);
+                if (result.view) {
                     ghostViews.push_back(std::move(result.view));
                 }
-                break;
             }
+            break;
+        }
 
-            case 'B': {
-                if (factory) {
-                    auto result = factory->createGhost(normalizedX, normalizedY, cellWidth * 0.85f, cellHeight * 0.85f,
-                                                       GhostType::BLUE, 5.0f); // 5s spawn delay
-
-                    if (auto ghostPtr = std::dynamic_pointer_cast<GhostModel>(result.model)) {
-                        ghostPtr->setCellDimensions(cellWidth, cellHeight);
-                        ghosts.push_back(ghostPtr);
-                        ghostSpawnPositions.push_back({normalizedX, normalizedY});
-
-                        // NoEntry barrier blocks ORANGE from BLUE's spawn position
-                        auto barrierResult = factory->createNoEntry(normalizedX, normalizedY, cellWidth, cellHeight);
-                        if (auto barrier = std::dynamic_pointer_cast<NoEntryModel>(barrierResult.model)) {
-                            barrier->clearBlockedGhostTypes();
-                            barrier->addBlockedGhostType(GhostType::ORANGE);
-                            noEntries.push_back(barrier);
-                        }
-                        entities.push_back(barrierResult.model);
+        case 'B': {
+            if (factory) {
+                auto result = factory->createGhost(arena, movingEntities, normalizedX, normalizedY, cellWidth * 0.85f,
+                                                   cellHeight * 0.85f, GhostType::BLUE, 5.0f); // 5s spawn delay
+
+                if (auto ghostPtr = std::dynamic_pointer_cast<GhostModel>(result.model)) {
+                    ghostPtr->setCellDimensions(cellWidth, cellHeight);
+                    ghosts.push_back(ghostPtr);
+                    ghostSpawnPositions.push_back({normalizedX, normalizedY});
+
+                    // NoEntry barrier blocks ORANGE from BLUE's spawn position
+                    auto barrierResult = factory->createNoEntry(arena, normalizedX, normalizedY, cellWidth, cellHeight);
+                    if (auto barrier = std::dynamic_pointer_cast<NoEntryModel>(barrierResult.model)) {
+                        barrier->clearBlockedGhostTypes();
+                        barrier->addBlockedGhostType(GhostType::ORANGE);
+                        noEntries.push_back(barrier);
                     }
+                    entities.push_back(barrierResult.model);
+                }
 
-                    entities.push_back(result.model);
+                entities.push_back(result.model);
+                if (result.view) {
                     ghostViews.push_back(std::move(result.view));
                 }
-                break;
             }
+            break;
+        }
+
+        case 'O': {
+            if (factory) {
+                auto result = factory->createGhost(arena, movingEntities, normalizedX, normalizedY, cellWidth * 0.85f,
+                                                   cellHeight * 0.85f, GhostType::ORANGE, 10.0f); // 10s spawn delay
+
+                if (auto ghostPtr = std::dynamic_pointer_cast<GhostModel>(result.model)) {
+                    ghostPtr->setCellDimensions(cellWidth, cellHeight);
+                    ghosts.push_back(ghostPtr);
+
+                    ghostSpawnPositions.push_back({normalizedX, normalizedY});
 
-            case 'O': {
-                if (factory) {
-                    auto result = factory->createGhost(normalizedX, normalizedY, cellWidth * 0.85f, cellHeight * 0.85f,
-                                                       GhostType::ORANGE, 10.0f); // 10s spawn delay
-
-                    if (auto ghostPtr = std::dynamic_pointer_cast<GhostModel>(result.model)) {
-                        ghostPtr->setCellDimensions(cellWidth, cellHeight);
-                        ghosts.push_back(ghostPtr);
-
-                        ghostSpawnPositions.push_back({normalizedX, normalizedY});
-
-                        float centerSpawnX = -1.0f + cellWidth / 2.0f + 9 * cellWidth;
-                        float centerSpawnY = -1.0f + cellHeight / 2.0f + 9 * cellHeight;
-                        ghostPtr->setEatenRespawnPosition(centerSpawnX, centerSpawnY);
-
-                        // NoEntry barrier blocks BLUE from ORANGE's spawn position
-                        auto barrierResult = factory->createNoEntry(normalizedX, normalizedY, cellWidth, cellHeight);
-                        if (auto barrier = std::dynamic_pointer_cast<NoEntryModel>(barrierResult.model)) {
-                            barrier->clearBlockedGhostTypes();
-                            barrier->addBlockedGhostType(GhostType::BLUE);
-                            noEntries.push_back(barrier);
-                        }
-                        entities.push_back(barrierResult.model);
+                    float centerSpawnX = -1.0f + cellWidth / 2.0f + 9 * cellWidth;
+                    float centerSpawnY = -1.0f + cellHeight / 2.0f + 9 * cellHeight;
+                    ghostPtr->setEatenRespawnPosition(centerSpawnX, centerSpawnY);
+
+                    // NoEntry barrier blocks BLUE from ORANGE's spawn position
+                    auto barrierResult = factory->createNoEntry(arena, normalizedX, normalizedY, cellWidth, cellHeight);
+                    if (auto barrier = std::dynamic_pointer_cast<NoEntryModel>(barrierResult.model)) {
+                        barrier->clearBlockedGhostTypes();
+                        barrier->addBlockedGhostType(GhostType::BLUE);
+                        noEntries.push_back(barrier);
                     }
+                    entities.push_back(barrierResult.model);
+                }
 
-                    entities.push_back(result.model);
+                entities.push_back(result.model);
+                if (result.view) {
                     ghostViews.push_back(std::move(result.view));
                 }
-                break;
             }
+            break;
+        }
 
-            case '.': {
-                if (factory) {
-                    auto result = factory->createCoin(normalizedX, normalizedY, cellWidth * 0.15f, cellHeight * 0.15f);
+        case '.': {
+            if (factory) {
+                auto result = factory->createCoin(arena, normalizedX, normalizedY, cellWidth * 0.15f,
+                                                  cellHeight * 0.15f);
 
-                    if (auto coinPtr = std::dynamic_pointer_cast<CoinModel>(result.model)) {
-                        coins.push_back(coinPtr);
-                    }
+                if (auto coinPtr = std::dynamic_pointer_cast<CoinModel>(result.model)) {
+                    coinIndexByCell[tileGrid.cellIndex(col, row)] = static_cast<int>(coins.size());
+                    coins.push_back(coinPtr);
+                }
 
-                    entities.push_back(result.model);
+                entities.push_back(result.model);
+                if (result.view) {
                     coinViews.push_back(std::move(result.view));
                 }
-                break;
             }
+            break;
+        }
 
-            case 'N': {
-                if (factory) {
-                    auto result = factory->createNoEntry(normalizedX, normalizedY, cellWidth, cellHeight);
-
-                    if (auto noEntryPtr = std::dynamic_pointer_cast<NoEntryModel>(result.model)) {
-                        noEntries.push_back(noEntryPtr);
-                    }
+        case 'N': {
+            if (factory) {
+                auto result = factory->createNoEntry(arena, normalizedX, normalizedY, cellWidth, cellHeight);
 
-                    entities.push_back(result.model);
+                if (auto noEntryPtr = std::dynamic_pointer_cast<NoEntryModel>(result.model)) {
+                    noEntries.push_back(noEntryPtr);
                 }
-                break;
+
+                entities.push_back(result.model);
             }
+            break;
+        }
 
-            case 'F': {
-                if (factory) {
-                    auto result = factory->createFruit(normalizedX, normalizedY, cellWidth * 0.3f, cellHeight * 0.3f);
+        case 'F': {
+            if (factory) {
+                auto result = factory->createFruit(arena, normalizedX, normalizedY, cellWidth * 0.3f,
+                                                   cellHeight * 0.3f);
 
-                    if (auto fruitPtr = std::dynamic_pointer_cast<FruitModel>(result.model)) {
-                        fruits.push_back(fruitPtr);
-                    }
+                if (auto fruitPtr = std::dynamic_pointer_cast<FruitModel>(result.model)) {
+                    fruitIndexByCell[tileGrid.cellIndex(col, row)] = static_cast<int>(fruits.size());
+                    fruits.push_back(fruitPtr);
+                }
 
-                    entities.push_back(result.model);
+                entities.push_back(result.model);
+                if (result.view) {
                     fruitViews.push_back(std::move(result.view));
                 }
-                break;
             }
-            case '*':
-                break;
+            break;
+        }
+        case '*':
+            break;
 
-            default:
-                break;
-            }
+        default:
+            break;
         }
     }
-}
 
-std::shared_ptr<PacManModel> World::getPacMan() {
-    for (auto& entity : entities) {
-        if (entity->isPacMan()) {
-            return std::dynamic_pointer_cast<PacManModel>(entity);
+    // PacMan last, so ghost i occupies MovingEntityStore slot i
+    for (size_t spawn = 0; spawn < map.getSpawnCount() && factory; spawn++) {
+        int cell = static_cast<int>(map.getSpawnCell(spawn));
+        if (map.getSymbol(cell) != 'C') {
+            continue;
         }
-    }
-    return nullptr;
-}
+        float normalizedX = -1.0f + cellWidth / 2.0f + (cell % width) * cellWidth;
+        float normalizedY = -1.0f + cellHeight / 2.0f + (cell / width) * cellHeight;
 
-std::pair<int, int> World::getMapDimensions(const std::string& filename) {
-    std::ifstream file(filename);
-    if (!file.is_open()) {
-        return {0, 0};
+        auto result = factory->createPacMan(arena, movingEntities, normalizedX, normalizedY, cellWidth * 0.9f,
+                                            cellHeight * 0.9f, 0.5f);
+
+        pacman = std::dynamic_pointer_cast<PacManModel>(result.model);
+        if (pacman) {
+            pacman->setCellDimensions(cellWidth, cellHeight);
+        }
+
+        pacmanSpawnX = normalizedX;
+        pacmanSpawnY = normalizedY;
+
+        entities.push_back(result.model);
+        pacmanView = std::move(result.view);
     }
 
-    std::vector<std::string> lines;
-    std::string line;
-    while (std::getline(file, line)) {
-        lines.push_back(line);
+    buildGhostHomeFields();
+    ghostPathfinder.build(tileGrid, true);
+    intersectionGraph.build(tileGrid, true);
+    scheduleAllGhostDecisions();
+    seedGhostStreams();
+
+    coinCollection.resize(coins.size());
+    for (size_t i = 0; i < coins.size(); i++) {
+        coins[i]->bindCollectionState(&coinCollection, i);
     }
-    file.close();
 
-    if (lines.empty()) {
-        return {0, 0};
+    fruitCollection.resize(fruits.size());
+    for (size_t i = 0; i < fruits.size(); i++) {
+        fruits[i]->bindCollectionState(&fruitCollection, i);
     }
 
-    int height = static_cast<int>(lines.size());
-    int width = static_cast<int>(lines[0].length());
+    ghostContacts.resize(ghosts.size());
 
-    return {width, height};
+    snapshot(pristineState);
 }
 
-bool World::isDirectionValid(Direction direction) const {
-    if (!pacman)
-        return false;
-    if (direction == Direction::NONE)
-        return true;
+void World::setSeed(uint64_t newSeed) {
+    seed = newSeed;
+    seedGhostStreams();
+}
 
-    // Predictive collision: test position 0.1 units ahead
-    const float TEST_DISTANCE = 0.1f;
+void World::seedGhostStreams() {
+    for (size_t i = 0; i < ghosts.size(); i++) {
+        ghosts[i]->getRandom().seed(seed, i + 1);
+    }
+}
 
-    float testX = pacman->getX();
-    float testY = pacman->getY();
+namespace {
+class Fnv1a {
+    uint64_t hash = 14695981039346656037ull;
 
-    switch (direction) {
-    case Direction::LEFT:
-        testX -= TEST_DISTANCE;
-        break;
-    case Direction::RIGHT:
-        testX += TEST_DISTANCE;
-        break;
-    case Direction::UP:
-        testY -= TEST_DISTANCE;
-        break;
-    case Direction::DOWN:
-        testY += TEST_DISTANCE;
-        break;
-    case Direction::NONE:
-        break;
+public:
+    void add(const void* data, size_t size) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; i++) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
     }
 
-    float width = pacman->getWidth();
-    float height = pacman->getHeight();
+    void add(int value) { add(&value, sizeof(value)); }
 
-    float left = testX - width / 2.0f;
-    float right = testX + width / 2.0f;
-    float top = testY - height / 2.0f;
-    float bottom = testY + height / 2.0f;
+    void add(float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        add(&bits, sizeof(bits));
+    }
 
-    for (auto& wall : walls) {
-        float wallLeft = wall->getX() - wall->getWidth() / 2.0f;
-        float wallRight = wall->getX() + wall->getWidth() / 2.0f;
-        float wallTop = wall->getY() - wall->getHeight() / 2.0f;
-        float wallBottom = wall->getY() + wall->getHeight() / 2.0f;
+    uint64_t get() const { return hash; }
+};
+} // namespace
 
-        if (!(right < wallLeft || left > wallRight || bottom < wallTop || top > wallBottom)) {
-            return false;
-        }
-    }
+uint64_t World::checksum() const {
+    Fnv1a hash;
+    hash.add(score.getScore());
+    hash.add(currentLevel);
+    hash.add(deaths);
+    hash.add(fearModeActive ? 1 : 0);
+    hash.add(fearModeTimer);
 
-    for (auto& door : doors) {
-        float doorLeft = door->getX() - door->getWidth() / 2.0f;
-        float doorRight = door->getX() + door->getWidth() / 2.0f;
-        float doorTop = door->getY() - door->getHeight() / 2.0f;
-        float doorBottom = door->getY() + door->getHeight() / 2.0f;
+    if (pacman) {
+        hash.add(pacman->getX());
+        hash.add(pacman->getY());
+        hash.add(static_cast<int>(pacman->getCurrentDirection()));
+        hash.add(pacman->getLives());
+    }
 
-        if (!(right < doorLeft || left > doorRight || bottom < doorTop || top > doorBottom)) {
-            return false;
-        }
+    for (const auto& ghost : ghosts) {
+        hash.add(ghost->getX());
+        hash.add(ghost->getY());
+        hash.add(static_cast<int>(ghost->getState()));
+        hash.add(static_cast<int>(ghost->getCurrentDirection()));
     }
 
-    return true;
+    for (size_t i = 0; i < coinCollection.size(); i++) {
+        hash.add(coinCollection.test(i) ? 1 : 0);
+    }
+    for (size_t i = 0; i < fruitCollection.size(); i++) {
+        hash.add(fruitCollection.test(i) ? 1 : 0);
+    }
+    return hash.get();
 }
 
-Direction World::getViableDirectionForGhost(std::shared_ptr<GhostModel> ghost) const {
-    if (!ghost)
-        return Direction::NONE;
-
-    const float TEST_DISTANCE = 0.1f;
+namespace {
+// Pickup bits go out in bytes, least significant bit first (bit i of a byte = pickup 8 * byte + i)
+void writeBits(ByteWriter& writer, const std::vector<uint64_t>& words, size_t bitCount) {
+    writer.writeVarint(bitCount);
+    for (size_t i = 0; i < bitCount; i += 8) {
+        writer.writeByte(static_cast<uint8_t>(words[i >> 6] >> (i & 63)));
+    }
+}
 
-    std::vector<Direction> viableDirections;
+void readBits(ByteReader& reader, std::vector<uint64_t>& words, size_t bitCount) {
+    if (reader.readVarint() != bitCount) {
+        throw std::runtime_error("ERROR: World state does not match loaded map (pickup count)");
+    }
+    words.assign((bitCount + 63) / 64, 0);
+    for (size_t i = 0; i < bitCount; i += 8) {
+        uint64_t byte = reader.readByte();
+        if (bitCount - i < 8) {
+            byte &= (uint64_t(1) << (bitCount - i)) - 1; // Keep bits past the last pickup cleared
+        }
+        words[i >> 6] |= byte << (i & 63);
+    }
+}
+} // namespace
+
+void World::snapshot(Snapshot& out) const {
+    out.score = score.snapshot();
+    out.level = currentLevel;
+    out.deaths = deaths;
+    out.hasJustRespawned = hasJustRespawned;
+    out.fearModeActive = fearModeActive;
+    out.fearModeTimer = fearModeTimer;
+    out.baseGhostSpeed = baseGhostSpeed;
+    out.baseFearDuration = baseFearDuration;
+
+    out.hasPacMan = pacman != nullptr;
+    out.pacman = pacman ? pacman->snapshot() : PacManModel::Snapshot{};
+
+    out.ghosts.resize(ghosts.size());
+    for (size_t i = 0; i < ghosts.size(); i++) {
+        out.ghosts[i] = ghosts[i]->snapshot();
+    }
 
-    for (Direction dir : {Direction::UP, Direction::DOWN, Direction::LEFT, Direction::RIGHT}) {
-        float testX = ghost->getX();
-        float testY = ghost->getY();
+    out.coinWords.assign(coinCollection.data(), coinCollection.data() + coinCollection.wordCount());
+    out.fruitWords.assign(fruitCollection.data(), fruitCollection.data() + fruitCollection.wordCount());
+}
 
-        switch (dir) {
-        case Direction::LEFT:
-            testX -= TEST_DISTANCE;
-            break;
-        case Direction::RIGHT:
-            testX += TEST_DISTANCE;
-            break;
-        case Direction::UP:
-            testY -= TEST_DISTANCE;
-            break;
-        case Direction::DOWN:
-            testY += TEST_DISTANCE;
-            break;
-        case Direction::NONE:
-            break;
-        }
+World::Snapshot World::snapshot() const {
+    Snapshot state;
+    snapshot(state);
+    return state;
+}
 
-        float width = ghost->getWidth();
-        float height = ghost->getHeight();
+void World::restore(const Snapshot& state) {
+    if (state.hasPacMan != (pacman != nullptr)) {
+        throw std::runtime_error("ERROR: World state does not match loaded map (PacMan)");
+    }
+    if (state.ghosts.size() != ghosts.size()) {
+        throw std::runtime_error("ERROR: World state does not match loaded map (ghost count)");
+    }
+    if (state.coinWords.size() != coinCollection.wordCount() ||
+        state.fruitWords.size() != fruitCollection.wordCount()) {
+        throw std::runtime_error("ERROR: World state does not match loaded map (pickup count)");
+    }
 
-        float left = testX - width / 2.0f;
-        float right = testX + width / 2.0f;
-        float top = testY - height / 2.0f;
-        float bottom = testY + height / 2.0f;
+    score.restore(state.score);
+    currentLevel = state.level;
+    deaths = state.deaths;
+    hasJustRespawned = state.hasJustRespawned;
+    fearModeActive = state.fearModeActive;
+    fearModeTimer = state.fearModeTimer;
+    baseGhostSpeed = state.baseGhostSpeed;
+    baseFearDuration = state.baseFearDuration;
 
-        bool hitObstacle = false;
+    if (pacman) {
+        pacman->restore(state.pacman);
+    }
 
-        for (auto& wall : walls) {
-            float wallLeft = wall->getX() - wall->getWidth() / 2.0f;
-            float wallRight = wall->getX() + wall->getWidth() / 2.0f;
-            float wallTop = wall->getY() - wall->getHeight() / 2.0f;
-            float wallBottom = wall->getY() + wall->getHeight() / 2.0f;
+    for (size_t i = 0; i < ghosts.size(); i++) {
+        ghosts[i]->restore(state.ghosts[i]);
+    }
 
-            if (!(right < wallLeft || left > wallRight || bottom < wallTop || top > wallBottom)) {
-                hitObstacle = true;
-                break;
-            }
-        }
+    coinCollection.assignWords(state.coinWords.data());
+    fruitCollection.assignWords(state.fruitWords.data());
 
-        if (!hitObstacle) {
-            for (auto& door : doors) {
-                float doorLeft = door->getX() - door->getWidth() / 2.0f;
-                float doorRight = door->getX() + door->getWidth() / 2.0f;
-                float doorTop = door->getY() - door->getHeight() / 2.0f;
-                float doorBottom = door->getY() + door->getHeight() / 2.0f;
+    // Decision times are derived state: waking every ghost early is harmless
+    scheduleAllGhostDecisions();
+}
 
-                if (!(right < doorLeft || left > doorRight || bottom < doorTop || top > doorBottom)) {
-                    if (ghost->hasExited()) {
-                        hitObstacle = true;
-                        break;
-                    }
-                }
-            }
-        }
+void World::writeState(ByteWriter& writer) const {
+    Snapshot state;
+    snapshot(state);
+
+    writer.writeSignedVarint(state.score.score);
+    writer.writeFloat(state.score.timeSinceLastCoin);
+    writer.writeFloat(state.score.accumulatedDecay);
+    writer.writeByte(static_cast<uint8_t>(state.score.lastEvent));
+
+    writer.writeVarint(static_cast<uint64_t>(state.level));
+    writer.writeVarint(static_cast<uint64_t>(state.deaths));
+    writer.writeByte(static_cast<uint8_t>((state.hasJustRespawned ? 1 : 0) | (state.fearModeActive ? 2 : 0)));
+    writer.writeFloat(state.fearModeTimer);
+    writer.writeFloat(state.baseGhostSpeed);
+    writer.writeFloat(state.baseFearDuration);
+
+    writer.writeByte(state.hasPacMan ? 1 : 0);
+    if (state.hasPacMan) {
+        const PacManModel::Snapshot& pm = state.pacman;
+        writer.writeFloat(pm.x);
+        writer.writeFloat(pm.y);
+        writer.writeFloat(pm.speed);
+        writer.writeSignedVarint(pm.lives);
+        writer.writeByte(static_cast<uint8_t>(static_cast<int>(pm.currentDirection) |
+                                              static_cast<int>(pm.nextDirection) << 4));
+        writer.writeByte(pm.isDying ? 1 : 0);
+        writer.writeFloat(pm.deathTimer);
+    }
 
-        if (!hitObstacle) {
-            for (auto& noEntry : noEntries) {
-                float neLeft = noEntry->getX() - noEntry->getWidth() / 2.0f;
-                float neRight = noEntry->getX() + noEntry->getWidth() / 2.0f;
-                float neTop = noEntry->getY() - noEntry->getHeight() / 2.0f;
-                float neBottom = noEntry->getY() + noEntry->getHeight() / 2.0f;
+    writer.writeVarint(state.ghosts.size());
+    for (const GhostModel::Snapshot& g : state.ghosts) {
+        writer.writeFloat(g.x);
+        writer.writeFloat(g.y);
+        writer.writeByte(static_cast<uint8_t>(g.state));
+        writer.writeFloat(g.spawnDelay);
+        writer.writeFloat(g.spawnTimer);
+        writer.writeFloat(g.speed);
+        writer.writeFloat(g.targetSpeed);
+        writer.writeByte(static_cast<uint8_t>(static_cast<int>(g.currentDirection) | (g.hasExitedSpawn ? 0x10 : 0)));
+        writer.writeFloat(g.eatenRespawnX);
+        writer.writeFloat(g.eatenRespawnY);
+        writer.writeFloat(g.exitTimer);
+        writer.writeFloat(g.fearTimer);
+        writer.writeFloat(g.respawnFlickerTimer);
+        writer.writeSignedVarint(g.respawnFlickerCount);
+        writer.writeSignedVarint(g.decisionNode);
+        writer.writeFixed64(g.random.state);
+        writer.writeVarint(g.random.increment);
+    }
 
-                if (!(right < neLeft || left > neRight || bottom < neTop || top > neBottom)) {
-                    hitObstacle = true;
-                    break;
-                }
-            }
-        }
+    writeBits(writer, state.coinWords, coinCollection.size());
+    writeBits(writer, state.fruitWords, fruitCollection.size());
+}
 
-        if (!hitObstacle) {
-            viableDirections.push_back(dir);
-        }
+void World::readState(ByteReader& reader) {
+    Snapshot state;
+    state.score.score = static_cast<int>(reader.readSignedVarint());
+    state.score.timeSinceLastCoin = reader.readFloat();
+    state.score.accumulatedDecay = reader.readFloat();
+    state.score.lastEvent = static_cast<ScoreEvent>(reader.readByte());
+
+    state.level = static_cast<int>(reader.readVarint());
+    state.deaths = static_cast<int>(reader.readVarint());
+    uint8_t flags = reader.readByte();
+    state.hasJustRespawned = flags & 1;
+    state.fearModeActive = flags & 2;
+    state.fearModeTimer = reader.readFloat();
+    state.baseGhostSpeed = reader.readFloat();
+    state.baseFearDuration = reader.readFloat();
+
+    state.hasPacMan = reader.readByte() != 0;
+    state.pacman = PacManModel::Snapshot{};
+    if (state.hasPacMan) {
+        PacManModel::Snapshot& pm = state.pacman;
+        pm.x = reader.readFloat();
+        pm.y = reader.readFloat();
+        pm.speed = reader.readFloat();
+        pm.lives = static_cast<int>(reader.readSignedVarint());
+        uint8_t directions = reader.readByte();
+        pm.currentDirection = static_cast<Direction>(directions & 0x0F);
+        pm.nextDirection = static_cast<Direction>(directions >> 4);
+        pm.isDying = reader.readByte() != 0;
+        pm.deathTimer = reader.readFloat();
     }
 
-    if (viableDirections.empty()) {
-        return Direction::NONE;
+    // Checked before reading on: a corrupt count must not size the ghost array
+    if (reader.readVarint() != ghosts.size()) {
+        throw std::runtime_error("ERROR: World state does not match loaded map (ghost count)");
+    }
+    state.ghosts.resize(ghosts.size());
+    for (GhostModel::Snapshot& g : state.ghosts) {
+        g.x = reader.readFloat();
+        g.y = reader.readFloat();
+        g.state = static_cast<GhostState>(reader.readByte());
+        g.spawnDelay = reader.readFloat();
+        g.spawnTimer = reader.readFloat();
+        g.speed = reader.readFloat();
+        g.targetSpeed = reader.readFloat();
+        uint8_t direction = reader.readByte();
+        g.currentDirection = static_cast<Direction>(direction & 0x0F);
+        g.hasExitedSpawn = direction & 0x10;
+        g.eatenRespawnX = reader.readFloat();
+        g.eatenRespawnY = reader.readFloat();
+        g.exitTimer = reader.readFloat();
+        g.fearTimer = reader.readFloat();
+        g.respawnFlickerTimer = reader.readFloat();
+        g.respawnFlickerCount = static_cast<int>(reader.readSignedVarint());
+        g.decisionNode = static_cast<int>(reader.readSignedVarint());
+        g.random.state = reader.readFixed64();
+        g.random.increment = reader.readVarint();
     }
 
-    int randomIndex = Random::getInstance().getInt(0, static_cast<int>(viableDirections.size()) - 1);
-    return viableDirections[randomIndex];
-}
+    readBits(reader, state.coinWords, coinCollection.size());
+    readBits(reader, state.fruitWords, fruitCollection.size());
 
-std::vector<Direction> World::getViableDirectionsForGhost(std::shared_ptr<GhostModel> ghost) const {
-    if (!ghost)
-        return {};
+    restore(state);
+}
 
-    const float TEST_DISTANCE = 0.1f;
-    std::vector<Direction> viableDirections;
+std::shared_ptr<PacManModel> World::getPacMan() const { return pacman; }
 
-    for (Direction dir : {Direction::UP, Direction::DOWN, Direction::LEFT, Direction::RIGHT}) {
-        float testX = ghost->getX();
-        float testY = ghost->getY();
+std::pair<int, int> World::getMapDimensions(const std::string& filename) {
+    return MapCache::getInstance().getDimensions(filename);
+}
 
-        switch (dir) {
-        case Direction::LEFT:
-            testX -= TEST_DISTANCE;
-            break;
-        case Direction::RIGHT:
-            testX += TEST_DISTANCE;
-            break;
-        case Direction::UP:
-            testY -= TEST_DISTANCE;
-            break;
-        case Direction::DOWN:
-            testY += TEST_DISTANCE;
-            break;
-        case Direction::NONE:
-            break;
-        }
+bool World::isDirectionValid(Direction direction) const {
+    if (!pacman)
+        return false;
+    if (direction == Direction::NONE)
+        return true;
 
-        float width = ghost->getWidth();
-        float height = ghost->getHeight();
+    // Predictive collision: test position 0.1 units ahead
+    const float TEST_DISTANCE = 0.1f;
 
-        float left = testX - width / 2.0f;
-        float right = testX + width / 2.0f;
-        float top = testY - height / 2.0f;
-        float bottom = testY + height / 2.0f;
+    float offsetX = 0.0f;
+    float offsetY = 0.0f;
 
-        bool hitObstacle = false;
+    switch (direction) {
+    case Direction::LEFT:
+        offsetX = -TEST_DISTANCE;
+        break;
+    case Direction::RIGHT:
+        offsetX = TEST_DISTANCE;
+        break;
+    case Direction::UP:
+        offsetY = -TEST_DISTANCE;
+        break;
+    case Direction::DOWN:
+        offsetY = TEST_DISTANCE;
+        break;
+    case Direction::NONE:
+        break;
+    }
 
-        for (auto& wall : walls) {
-            float wallLeft = wall->getX() - wall->getWidth() / 2.0f;
-            float wallRight = wall->getX() + wall->getWidth() / 2.0f;
-            float wallTop = wall->getY() - wall->getHeight() / 2.0f;
-            float wallBottom = wall->getY() + wall->getHeight() / 2.0f;
+    return !overlapsTiles(*pacman, offsetX, offsetY, TileGrid::WALL | TileGrid::DOOR);
+}
 
-            if (!(right < wallLeft || left > wallRight || bottom < wallTop || top > wallBottom)) {
-                hitObstacle = true;
-                break;
-            }
-        }
+Direction World::getViableDirectionForGhost(GhostModel& ghost) const {
+    DirectionMask viableDirections = getViableDirectionMask(ghost);
 
-        if (!hitObstacle) {
-            for (auto& door : doors) {
-                float doorLeft = door->getX() - door->getWidth() / 2.0f;
-                float doorRight = door->getX() + door->getWidth() / 2.0f;
-                float doorTop = door->getY() - door->getHeight() / 2.0f;
-                float doorBottom = door->getY() + door->getHeight() / 2.0f;
+    if (viableDirections == 0) {
+        return Direction::NONE;
+    }
 
-                if (!(right < doorLeft || left > doorRight || bottom < doorTop || top > doorBottom)) {
-                    if (ghost->hasExited()) {
-                        hitObstacle = true;
-                        break;
-                    }
-                }
-            }
+    int randomIndex = ghost.getRandom().getInt(0, directionCount(viableDirections) - 1);
+    for (Direction dir : MOVE_DIRECTIONS) {
+        if ((viableDirections & directionBit(dir)) && randomIndex-- == 0) {
+            return dir;
         }
+    }
+    return Direction::NONE;
+}
 
-        if (!hitObstacle) {
-            for (auto& noEntry : noEntries) {
-                float neLeft = noEntry->getX() - noEntry->getWidth() / 2.0f;
-                float neRight = noEntry->getX() + noEntry->getWidth() / 2.0f;
-                float neTop = noEntry->getY() - noEntry->getHeight() / 2.0f;
-                float neBottom = noEntry->getY() + noEntry->getHeight() / 2.0f;
+DirectionMask World::getViableDirectionMask(const GhostModel& ghost) const {
+    int col = tileGrid.columnAt(ghost.getX());
+    int row = tileGrid.rowAt(ghost.getY());
 
-                if (!(right < neLeft || left > neRight || bottom < neTop || top > neBottom)) {
-                    hitObstacle = true;
-                    break;
-                }
-            }
-        }
+    // Doors only block ghosts that already left the spawn area
+    DirectionMask viableDirections = tileGrid.getGhostDirectionMask(col, row, ghost.hasExited());
 
-        if (!hitObstacle) {
-            viableDirections.push_back(dir);
-        }
+    // Turning onto an axis requires the ghost's box to fit inside its cell across that axis
+    float toleranceX = (tileGrid.getCellWidth() - ghost.getWidth()) / 2.0f;
+    float toleranceY = (tileGrid.getCellHeight() - ghost.getHeight()) / 2.0f;
+
+    if (std::abs(ghost.getX() - tileGrid.getCellCenterX(col)) > toleranceX) {
+        viableDirections &= ~(directionBit(Direction::UP) | directionBit(Direction::DOWN));
+    }
+    if (std::abs(ghost.getY() - tileGrid.getCellCenterY(row)) > toleranceY) {
+        viableDirections &= ~(directionBit(Direction::LEFT) | directionBit(Direction::RIGHT));
     }
 
     return viableDirections;
@@ -786,12 +1247,68 @@ void World::clearWorld() {
     pacmanView.reset();
 
     entities.clear();
-
-    coinsCollected = 0;
+    movingEntities.clear();
+    arena.release();
+
+    tileGrid.clear();
+    pacmanDistanceField.clear();
+    pacmanFieldCell = -1;
+    ghostHomeFields.clear();
+    ghostHomeCells.clear();
+    ghostPathfinder.clear();
+    intersectionGraph.clear();
+    ghostDecisionTimes.clear();
+
+    coinIndexByCell.clear();
+    fruitIndexByCell.clear();
+    coinCollection.resize(0);
+    fruitCollection.resize(0);
+    ghostContacts.resize(0);
 
     ghostSpawnPositions.clear();
 }
 
+bool World::overlapsTiles(const MovingEntityModel& entity, float offsetX, float offsetY, uint8_t flags) const {
+    float centerX = entity.getX() + offsetX;
+    float centerY = entity.getY() + offsetY;
+    float halfWidth = entity.getWidth() / 2.0f;
+    float halfHeight = entity.getHeight() / 2.0f;
+
+    return tileGrid.overlaps(centerX - halfWidth, centerX + halfWidth, centerY - halfHeight, centerY + halfHeight,
+                             flags);
+}
+
+void World::collectPickups(PacManModel& pm) {
+    float halfWidth = pm.getWidth() / 2.0f;
+    float halfHeight = pm.getHeight() / 2.0f;
+    TileGrid::CellRange cells = tileGrid.getOverlappedCells(pm.getX() - halfWidth, pm.getX() + halfWidth,
+                                                            pm.getY() - halfHeight, pm.getY() + halfHeight);
+
+    for (int row = cells.minRow; row <= cells.maxRow; row++) {
+        for (int col = cells.minCol; col <= cells.maxCol; col++) {
+            int cell = tileGrid.cellIndex(col, row);
+
+            int coinIndex = coinIndexByCell[cell];
+            if (coinIndex >= 0 && !coinCollection.test(coinIndex) && pm.intersects(*coins[coinIndex])) {
+                coinCollection.set(coinIndex);
+
+                score.setEvent(ScoreEvent::COIN_COLLECTED);
+                scoreSubject.notify();
+            }
+
+            int fruitIndex = fruitIndexByCell[cell];
+            if (fruitIndex >= 0 && !fruitCollection.test(fruitIndex) && pm.intersects(*fruits[fruitIndex])) {
+                fruitCollection.set(fruitIndex);
+
+                score.setEvent(ScoreEvent::FRUIT_EATEN);
+                scoreSubject.notify();
+
+                activateFearMode();
+            }
+        }
+    }
+}
+
 void World::handlePacManDeath() {
     if (!pacman)
         return;
@@ -801,6 +1318,7 @@ void World::handlePacManDeath() {
 
     pacman->startDeath();
     pacman->loseLife();
+    deaths++;
 
     score.setEvent(ScoreEvent::PACMAN_DIED);
     scoreSubject.notify();
@@ -817,7 +1335,7 @@ void World::resetAfterDeath() {
         float spawnX = ghostSpawnPositions[i].first;
         float spawnY = ghostSpawnPositions[i].second;
 
-        ghost->setPosition(spawnX, spawnY);
+        ghost->teleport(spawnX, spawnY);
         ghost->stopMovement();
 
         if (ghost->getType() == GhostType::RED) {
@@ -838,11 +1356,7 @@ void World::resetAfterDeath() {
     hasJustRespawned = true;
 }
 
-void World::notifyViewsOnly() {
-    for (const auto& entity : entities) {
-        entity->notify();
-    }
-}
+void World::storePreviousPositions() { movingEntities.storePreviousPositions(); }
 
 void World::renderInOrder() {
     // Render order: doors → walls → coins → fruits → ghosts → pacman
@@ -877,27 +1391,19 @@ void World::activateFearMode() {
     for (auto& ghost : ghosts) {
         ghost->enterFearMode();
     }
+    scheduleAllGhostDecisions(); // Reversed and slowed down
 }
 
 void World::nextLevel() {
     currentLevel++;
 
-    for (auto& coin : coins) {
-        coin->uncollect();
-        coin->notify();
-    }
-
-    for (auto& fruit : fruits) {
-        fruit->uncollect();
-        fruit->notify();
-    }
-
-    coinsCollected = 0;
+    // Bulk respawn: every coin/fruit reads its state from these bitsets
+    coinCollection.clearAll();
+    fruitCollection.clearAll();
 
     if (pacman) {
-        pacman->setPosition(pacmanSpawnX, pacmanSpawnY);
+        pacman->teleport(pacmanSpawnX, pacmanSpawnY);
         pacman->stopMovement();
-        pacman->notify();
     }
 
     for (size_t i = 0; i < ghosts.size() && i < ghostSpawnPositions.size(); i++) {
@@ -905,7 +1411,7 @@ void World::nextLevel() {
         float spawnX = ghostSpawnPositions[i].first;
         float spawnY = ghostSpawnPositions[i].second;
 
-        ghost->setPosition(spawnX, spawnY);
+        ghost->teleport(spawnX, spawnY);
 
         if (ghost->getType() == GhostType::RED) {
             ghost->resetToSpawn(0.0f);
@@ -925,4 +1431,10 @@ void World::nextLevel() {
     // Level progression: -0.5s fear duration per level (min 3s)
     baseFearDuration = std::max(3.0f, 7.0f - (currentLevel - 1) * 0.5f);
 }
+
+void World::restart() {
+    simulationTime = 0.0;
+    restore(pristineState);
+    seedGhostStreams();
+}
 } // namespace logic
@@ -3,6 +3,7 @@
 
 #include "logic/patterns/AbstractFactory.h"
 #include "representation/Camera.h"
+#include "representation/RenderInterpolation.h"
 #include <SFML/Graphics.hpp>
 
 namespace representation {
@@ -10,15 +11,18 @@ namespace representation {
  * Concrete implementation of AbstractFactory for creating SFML-coupled entities.
  *
  * Enables World (logic layer) to create entities without knowing about SFML:
- * - Creates EntityModel (shared_ptr, logic layer)
- * - Creates corresponding EntityView (unique_ptr, representation layer)
+ * - Creates EntityModel (shared_ptr, logic layer) in the World's level arena
+ * - Creates corresponding EntityView (ArenaPtr, representation layer) in the same arena
  * - Auto-attaches view as observer to model
  * - Returns both via EntityCreationResult struct
  *
  * Texture management:
- * - sharedTexture: Main sprite sheet (pacman_sprites.png) shared across all views
+ * - spriteTexture: Main sprite sheet (pacman_sprites.png) shared across all views
  * - doorTexture: Separate texture for door sprite (door_sprite.png)
- * - Loaded once in constructor, shared via shared_ptr to avoid redundant loads
+ * - Loaded once in constructor and owned here; views only reference them, so the factory
+ *   must outlive every World it fills (Game declares it before the StateManager)
+ *
+ * Moving-entity views (PacMan, ghosts) receive the game loop's RenderInterpolation.
  *
  * This enforces complete separation: logic library compiles without SFML.
  */
@@ -26,26 +30,28 @@ class ConcreteFactory : public logic::AbstractFactory {
 private:
     sf::RenderWindow* window;
     const Camera* camera;
-    std::shared_ptr<sf::Texture> sharedTexture;
-    std::shared_ptr<sf::Texture> doorTexture;
+    const RenderInterpolation* interpolation;
+    sf::Texture spriteTexture;
+    sf::Texture doorTexture;
 
 public:
-    ConcreteFactory(sf::RenderWindow* window, const Camera* camera);
+    ConcreteFactory(sf::RenderWindow* window, const Camera* camera, const RenderInterpolation* interpolation);
 
-    logic::EntityCreationResult createWall(float x, float y, float w, float h) override;
+    logic::EntityCreationResult createWall(logic::LevelArena& arena, float x, float y, float w, float h) override;
 
-    logic::EntityCreationResult createPacMan(float x, float y, float w, float h, float speed) override;
+    logic::EntityCreationResult createPacMan(logic::LevelArena& arena, logic::MovingEntityStore& store, float x,
+                                             float y, float w, float h, float speed) override;
 
-    logic::EntityCreationResult createCoin(float x, float y, float w, float h) override;
+    logic::EntityCreationResult createCoin(logic::LevelArena& arena, float x, float y, float w, float h) override;
 
-    logic::EntityCreationResult createGhost(float x, float y, float w, float h, logic::GhostType type,
-                                            float spawnDelay) override;
+    logic::EntityCreationResult createGhost(logic::LevelArena& arena, logic::MovingEntityStore& store, float x, float y,
+                                            float w, float h, logic::GhostType type, float spawnDelay) override;
 
-    logic::EntityCreationResult createDoor(float x, float y, float w, float h) override;
+    logic::EntityCreationResult createDoor(logic::LevelArena& arena, float x, float y, float w, float h) override;
 
-    logic::EntityCreationResult createNoEntry(float x, float y, float w, float h) override;
+    logic::EntityCreationResult createNoEntry(logic::LevelArena& arena, float x, float y, float w, float h) override;
 
-    logic::EntityCreationResult createFruit(float x, float y, float w, float h) override;
+    logic::EntityCreationResult createFruit(logic::LevelArena& arena, float x, float y, float w, float h) override;
 };
 } // namespace representation
 
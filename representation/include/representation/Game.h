@@ -3,6 +3,7 @@
 
 #include "Camera.h"
 #include "ConcreteFactory.h"
+#include "RenderInterpolation.h"
 #include "StateManager.h"
 #include <SFML/Graphics.hpp>
 #include <memory>
@@ -14,6 +15,7 @@ namespace representation {
  *
  * Responsibilities:
  * - Owns Camera (coordinate conversion)
+ * - Owns RenderInterpolation (tick blend factor for moving-entity views)
  * - Owns ConcreteFactory (entity creation with SFML coupling)
  * - Owns StateManager (state machine orchestration)
  * - Initializes with MenuState
@@ -26,23 +28,47 @@ class Game {
 private:
     sf::RenderWindow* window;
     std::unique_ptr<Camera> camera;
+    std::unique_ptr<RenderInterpolation> interpolation;
     std::unique_ptr<ConcreteFactory> factory;
     std::unique_ptr<StateManager> stateManager;
     std::string mapFile;
 
+    // Fixed-timestep accumulator: unsimulated wall time carried to the next frame
+    float tickAccumulator;
+    float tickDuration; // Seconds per simulation tick (Stopwatch::FIXED_TICK by default)
+
+    static constexpr float MAX_FRAME_TIME = 0.25f; // Longer hitches are dropped, not simulated
+    static constexpr int MAX_TICKS_PER_FRAME = 8;  // Catch-up cap (prevents spiral of death)
+
 public:
     Game(sf::RenderWindow* window, const std::string& mapFile);
     ~Game();
 
+    /**
+     * Sets simulation tick rate independently of the display rate
+     * (e.g. 30-60 Hz on low-end machines, views interpolate in between).
+     */
+    void setTickRate(int ticksPerSecond);
+
+    /**
+     * Starts playback of a recorded game on top of the menu, at the tick duration it was recorded with.
+     *
+     * @throws std::runtime_error if the replay cannot be loaded
+     */
+    void playReplay(const std::string& replayFile);
+
     /**
      * Executes main game loop until window closed:
      * 1. Update Stopwatch (deltaTime calculation)
      * 2. Poll SFML events (window close, keyboard input)
      * 3. Delegate event handling to active State
-     * 4. Update active State (game logic)
-     * 5. Render active State (SFML drawing)
+     * 4. Update active State in fixed ticks of tickDuration (0..MAX_TICKS_PER_FRAME per frame)
+     * 5. Render active State (SFML drawing), interpolated by leftover time / tickDuration
      * 6. Display to window
      *
+     * Simulation is independent of render rate: a hitch never produces a
+     * larger step (no tunneling through walls), only more steps.
+     *
      * Exception handling catches runtime errors and closes window gracefully.
      */
     void run();
@@ -0,0 +1,30 @@
+#ifndef PACMANGAME_RENDERINTERPOLATION_H
+#define PACMANGAME_RENDERINTERPOLATION_H
+
+#include <algorithm>
+
+namespace representation {
+/**
+ * Blend factor between the last two simulation ticks, shared by all moving-entity views.
+ *
+ * Game::run sets alpha after its fixed-step updates:
+ * alpha = unsimulated time / tick duration (0 = previous tick, 1 = current tick).
+ * PacManView/GhostView draw EntityModel::getInterpolatedX/Y(alpha), so motion
+ * stays smooth when the simulation ticks slower than the display refreshes.
+ *
+ * Inline implementation kept in header for simplicity (single value).
+ */
+class RenderInterpolation {
+private:
+    float alpha;
+
+public:
+    RenderInterpolation() : alpha(1.0f) {}
+
+    void setAlpha(float value) { alpha = std::clamp(value, 0.0f, 1.0f); }
+
+    float getAlpha() const { return alpha; }
+};
+} // namespace representation
+
+#endif // PACMANGAME_RENDERINTERPOLATION_H
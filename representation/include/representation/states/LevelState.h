@@ -2,6 +2,8 @@
 #define PACMANGAME_LEVELSTATE_H
 
 #include "State.h"
+#include "logic/replay/Replay.h"
+#include "logic/world/LevelSession.h"
 #include "logic/world/World.h"
 #include "representation/SoundObserver.h"
 #include <memory>
@@ -12,20 +14,23 @@ namespace representation {
  * Active gameplay state managing World logic, UI overlay, and input handling.
  *
  * Responsibilities:
- * - Owns World instance (game logic controller)
+ * - Owns World instance (game logic controller) and its LevelSession (level flow)
  * - Renders HUD (score, lives, level number)
- * - Countdown timer between deaths/level transitions
+ * - Presentation of countdowns between deaths/level transitions
  * - Cheat code detection (text input buffering)
  * - Sound event observation via SoundObserver
+ * - Replays: records every game to REPLAY_FILE, or plays a recorded one back (Left/Right to scrub)
  *
  * State transitions:
  * - P key → PausedState (push)
  * - All coins collected → next level (internal reset)
  * - Lives depleted → VictoryState or NameEntryState (push)
+ * - Restart (from PausedState/VictoryState) → restart() in place, no new LevelState
  */
 class LevelState : public State {
 private:
     std::unique_ptr<logic::World> world;
+    std::unique_ptr<logic::LevelSession> session;
     std::string mapFile;
 
     sf::Font font;
@@ -36,19 +41,44 @@ private:
     std::shared_ptr<sf::Texture> livesTexture;
     sf::Sprite livesSprite;
 
-    bool isCountingDown;
-    float countdownTimer;
-
     std::string cheatBuffer;
 
     std::unique_ptr<SoundObserver> soundObserver;
 
+    bool recordingSaved;
+
+    /**
+     * @param replay Recorded game to play back, nullptr to record a new one
+     */
+    LevelState(sf::RenderWindow* win, logic::AbstractFactory* fac, const Camera* cam, StateManager* sm,
+               const std::string& mapFile, const logic::Replay* replay);
+
+    /**
+     * Writes the recorded game to REPLAY_FILE once (errors are reported, not thrown).
+     */
+    void saveRecording();
+
 public:
+    static constexpr const char* REPLAY_FILE = "replays/last.replay";
+    static constexpr float SEEK_SECONDS = 5.0f; // Left/Right arrow jump during playback
+
     LevelState(sf::RenderWindow* win, logic::AbstractFactory* fac, const Camera* cam, StateManager* sm,
                const std::string& mapFile);
 
+    /**
+     * Playback of a recorded game: map and seed come from the replay, gameplay keys are ignored.
+     */
+    LevelState(sf::RenderWindow* win, logic::AbstractFactory* fac, const Camera* cam, StateManager* sm,
+               const logic::Replay& replay);
+
     ~LevelState();
 
+    /**
+     * Starts a new game on the same map without rebuilding anything: saves the finished recording,
+     * resets World and LevelSession in place (World::restart) and starts the countdown.
+     */
+    void restart();
+
     void update(float deltaTime) override;
 
     void render() override;
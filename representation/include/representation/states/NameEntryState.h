@@ -5,6 +5,8 @@
 #include <string>
 
 namespace representation {
+class LevelState;
+
 /**
  * Interactive state for entering player name when achieving high score.
  *
@@ -24,7 +26,7 @@ namespace representation {
 class NameEntryState : public State {
 private:
     int finalScore;
-    std::string mapFile;
+    LevelState* levelState; // Not owned - finished game below, handed on to VictoryState
 
     std::string playerName;
     int currentLetterIndex;
@@ -58,7 +60,7 @@ private:
 
 public:
     NameEntryState(sf::RenderWindow* win, logic::AbstractFactory* fac, const Camera* cam, StateManager* sm,
-                   int finalScore, const std::string& mapFile);
+                   int finalScore, LevelState* levelState);
 
     void update(float deltaTime) override;
 
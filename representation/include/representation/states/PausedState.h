@@ -4,6 +4,8 @@
 #include "State.h"
 
 namespace representation {
+class LevelState;
+
 /**
  * Overlay state for pausing gameplay without destroying LevelState.
  *
@@ -14,10 +16,10 @@ namespace representation {
  *
  * State transitions:
  * - P → pop (resume LevelState)
- * - R → pop twice + push new LevelState (restart level)
+ * - R → pop + LevelState::restart() (warm restart, nothing reloaded)
  * - ESC → pop twice (return to MenuState)
  *
- * CRITICAL: R key copies all needed data to locals BEFORE popState()
+ * CRITICAL: R key copies the LevelState pointer to a local BEFORE popState()
  * to prevent use-after-free (this object destroyed during pop).
  */
 class PausedState : public State {
@@ -29,12 +31,11 @@ private:
     sf::Text quitText;
     bool fontLoaded;
 
-    State* levelStateBelow; // Not owned - raw pointer to render frozen game underneath
-    std::string mapFile;
+    LevelState* levelStateBelow; // Not owned - raw pointer to render frozen game underneath
 
 public:
     PausedState(sf::RenderWindow* win, logic::AbstractFactory* fac, const Camera* cam, StateManager* sm,
-                State* levelState, const std::string& mapFile);
+                LevelState* levelState);
 
     void update(float deltaTime) override;
 
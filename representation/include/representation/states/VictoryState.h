@@ -5,6 +5,8 @@
 #include <string>
 
 namespace representation {
+class LevelState;
+
 /**
  * End-of-game state displaying final score and restart/quit options.
  *
@@ -19,17 +21,17 @@ namespace representation {
  * - Dark semi-transparent overlay over final game state
  *
  * State transitions:
- * - R → pop twice + push new LevelState (restart from level 1)
+ * - R → pop + LevelState::restart() (warm restart from level 1, nothing reloaded)
  * - ESC → pop twice (return to MenuState)
  *
- * CRITICAL: R key copies all needed data to locals BEFORE popState()
+ * CRITICAL: R key copies the LevelState pointer to a local BEFORE popState()
  * to prevent use-after-free (this object destroyed during pop).
  */
 class VictoryState : public State {
 private:
     bool won;
     int finalScore;
-    std::string mapFile;
+    LevelState* levelState; // Not owned - finished game below this state
 
     sf::Font font;
     sf::Text titleText;
@@ -49,7 +51,7 @@ public:
      *              (currently unused for rendering - always shows "GAME OVER")
      */
     VictoryState(sf::RenderWindow* win, logic::AbstractFactory* fac, const Camera* cam, StateManager* sm, bool won,
-                 int finalScore, const std::string& mapFile);
+                 int finalScore, LevelState* levelState);
 
     void update(float deltaTime) override;
 
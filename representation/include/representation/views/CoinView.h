@@ -17,12 +17,10 @@ namespace representation {
 class CoinView : public EntityView {
 private:
     logic::CoinModel* coinModel;
-    std::shared_ptr<sf::Texture> texture;
     sf::Sprite sprite;
 
 public:
-    CoinView(logic::CoinModel* model, sf::RenderWindow* window, const Camera* camera,
-             std::shared_ptr<sf::Texture> sharedTexture);
+    CoinView(logic::CoinModel* model, sf::RenderWindow* window, const Camera* camera, const sf::Texture& texture);
 
     void draw() override;
 };
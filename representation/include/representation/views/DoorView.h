@@ -17,14 +17,12 @@ namespace representation {
 class DoorView : public EntityView {
 private:
     logic::DoorModel* doorModel;
-    std::shared_ptr<sf::Texture> texture;
     sf::Sprite sprite;
 
     bool showDebugVisualization = false; // Green collision box overlay (development aid)
 
 public:
-    DoorView(logic::DoorModel* model, sf::RenderWindow* window, const Camera* camera,
-             std::shared_ptr<sf::Texture> sharedTexture);
+    DoorView(logic::DoorModel* model, sf::RenderWindow* window, const Camera* camera, const sf::Texture& texture);
 
     void draw() override;
 };
@@ -20,12 +20,10 @@ namespace representation {
 class FruitView : public EntityView {
 private:
     logic::FruitModel* fruitModel;
-    std::shared_ptr<sf::Texture> texture;
     sf::Sprite sprite;
 
 public:
-    FruitView(logic::FruitModel* model, sf::RenderWindow* window, const Camera* camera,
-              std::shared_ptr<sf::Texture> sharedTexture);
+    FruitView(logic::FruitModel* model, sf::RenderWindow* window, const Camera* camera, const sf::Texture& texture);
 
     void draw() override;
 };
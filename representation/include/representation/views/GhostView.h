@@ -3,6 +3,7 @@
 
 #include "EntityView.h"
 #include "logic/entities/GhostModel.h"
+#include "representation/RenderInterpolation.h"
 #include <memory>
 
 namespace representation {
@@ -17,21 +18,23 @@ namespace representation {
  *
  * Animation: 2-frame walking cycle, switches every 0.15s when moving.
  * Direction sprites: separate sprites for UP/DOWN/LEFT/RIGHT movement.
+ * Drawn at the position interpolated between the last two simulation ticks.
  */
 class GhostView : public EntityView {
 private:
     logic::GhostModel* ghostModel;
-    std::shared_ptr<sf::Texture> texture;
+    const RenderInterpolation* interpolation;
     sf::Sprite sprite;
 
     bool showDebugVisualization; // Green collision box + red center dot (development aid)
 
+    sf::Clock animationClock;
     float animationTimer;
     int frameIndex;
 
 public:
     GhostView(logic::GhostModel* model, sf::RenderWindow* window, const Camera* camera,
-              std::shared_ptr<sf::Texture> sharedTexture);
+              const RenderInterpolation* interpolation, const sf::Texture& texture);
 
     void draw() override;
 };
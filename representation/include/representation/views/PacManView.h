@@ -3,6 +3,7 @@
 
 #include "EntityView.h"
 #include "logic/entities/PacManModel.h"
+#include "representation/RenderInterpolation.h"
 #include <memory>
 
 namespace representation {
@@ -28,11 +29,12 @@ struct SpriteRect {
  *
  * Direction sprites: Separate sprite sets for UP/DOWN/LEFT/RIGHT movement.
  * Origin manually tuned to (29.5, 22.0) for accurate center-point rendering.
+ * Drawn at the position interpolated between the last two simulation ticks.
  */
 class PacManView : public EntityView {
 private:
     logic::PacManModel* pacManModel;
-    std::shared_ptr<sf::Texture> texture;
+    const RenderInterpolation* interpolation;
     sf::Sprite sprite;
 
     float animationTimer;
@@ -52,7 +54,7 @@ private:
 
 public:
     PacManView(logic::PacManModel* model, sf::RenderWindow* window, const Camera* camera,
-               std::shared_ptr<sf::Texture> sharedTexture);
+               const RenderInterpolation* interpolation, const sf::Texture& texture);
 
     void draw() override;
 };
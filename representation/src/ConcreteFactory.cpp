@@ -15,61 +15,63 @@
 #include <iostream>
 
 namespace representation {
-// Load shared textures once in constructor, throw on failure (fail-fast)
-ConcreteFactory::ConcreteFactory(sf::RenderWindow* window, const Camera* camera)
-    : window(window), camera(camera) {
+// Load textures once in constructor, throw on failure (fail-fast)
+ConcreteFactory::ConcreteFactory(sf::RenderWindow* window, const Camera* camera,
+                                 const RenderInterpolation* interpolation)
+    : window(window), camera(camera), interpolation(interpolation) {
 
-    sharedTexture = std::make_shared<sf::Texture>();
-    if (!sharedTexture->loadFromFile("resources/sprites/pacman_sprites.png")) {
+    if (!spriteTexture.loadFromFile("resources/sprites/pacman_sprites.png")) {
         throw std::runtime_error("ERROR: Failed to load pacman_sprites.png");
     }
 
-    doorTexture = std::make_shared<sf::Texture>();
-    if (!doorTexture->loadFromFile("resources/sprites/door_sprite.png")) {
+    if (!doorTexture.loadFromFile("resources/sprites/door_sprite.png")) {
         throw std::runtime_error("ERROR: Failed to load door_sprite.png");
     }
 }
 
-logic::EntityCreationResult ConcreteFactory::createWall(float x, float y, float w, float h) {
-    auto model = std::make_shared<logic::WallModel>(x, y, w, h);
-    auto view = std::make_unique<WallView>(model.get(), window, camera);
+logic::EntityCreationResult ConcreteFactory::createWall(logic::LevelArena& arena, float x, float y, float w, float h) {
+    auto model = arena.makeShared<logic::WallModel>(x, y, w, h);
+    auto view = arena.make<WallView>(model.get(), window, camera);
     return {model, std::move(view)};
 }
 
-logic::EntityCreationResult ConcreteFactory::createPacMan(float x, float y, float w, float h, float speed) {
-    auto model = std::make_shared<logic::PacManModel>(x, y, w, h, speed);
-    auto view = std::make_unique<PacManView>(model.get(), window, camera, sharedTexture);
+logic::EntityCreationResult ConcreteFactory::createPacMan(logic::LevelArena& arena, logic::MovingEntityStore& store,
+                                                          float x, float y, float w, float h, float speed) {
+    auto model = arena.makeShared<logic::PacManModel>(store, x, y, w, h, speed);
+    auto view = arena.make<PacManView>(model.get(), window, camera, interpolation, spriteTexture);
     return {model, std::move(view)};
 }
 
-logic::EntityCreationResult ConcreteFactory::createCoin(float x, float y, float w, float h) {
-    auto model = std::make_shared<logic::CoinModel>(x, y, w, h);
-    auto view = std::make_unique<CoinView>(model.get(), window, camera, sharedTexture);
+logic::EntityCreationResult ConcreteFactory::createCoin(logic::LevelArena& arena, float x, float y, float w, float h) {
+    auto model = arena.makeShared<logic::CoinModel>(x, y, w, h);
+    auto view = arena.make<CoinView>(model.get(), window, camera, spriteTexture);
     return {model, std::move(view)};
 }
 
-logic::EntityCreationResult ConcreteFactory::createGhost(float x, float y, float w, float h, logic::GhostType type,
+logic::EntityCreationResult ConcreteFactory::createGhost(logic::LevelArena& arena, logic::MovingEntityStore& store,
+                                                         float x, float y, float w, float h, logic::GhostType type,
                                                          float spawnDelay) {
-    auto model = std::make_shared<logic::GhostModel>(x, y, w, h, type, spawnDelay);
-    auto view = std::make_unique<GhostView>(model.get(), window, camera, sharedTexture);
+    auto model = arena.makeShared<logic::GhostModel>(store, x, y, w, h, type, spawnDelay);
+    auto view = arena.make<GhostView>(model.get(), window, camera, interpolation, spriteTexture);
     return {model, std::move(view)};
 }
 
-logic::EntityCreationResult ConcreteFactory::createDoor(float x, float y, float w, float h) {
-    auto model = std::make_shared<logic::DoorModel>(x, y, w, h);
-    auto view = std::make_unique<DoorView>(model.get(), window, camera, doorTexture);
+logic::EntityCreationResult ConcreteFactory::createDoor(logic::LevelArena& arena, float x, float y, float w, float h) {
+    auto model = arena.makeShared<logic::DoorModel>(x, y, w, h);
+    auto view = arena.make<DoorView>(model.get(), window, camera, doorTexture);
     return {model, std::move(view)};
 }
 
 // NoEntry is invisible barrier (collision logic only, no visual representation)
-logic::EntityCreationResult ConcreteFactory::createNoEntry(float x, float y, float w, float h) {
-    auto model = std::make_shared<logic::NoEntryModel>(x, y, w, h);
+logic::EntityCreationResult ConcreteFactory::createNoEntry(logic::LevelArena& arena, float x, float y, float w,
+                                                           float h) {
+    auto model = arena.makeShared<logic::NoEntryModel>(x, y, w, h);
     return {model, nullptr};
 }
 
-logic::EntityCreationResult ConcreteFactory::createFruit(float x, float y, float w, float h) {
-    auto model = std::make_shared<logic::FruitModel>(x, y, w, h);
-    auto view = std::make_unique<FruitView>(model.get(), window, camera, sharedTexture);
+logic::EntityCreationResult ConcreteFactory::createFruit(logic::LevelArena& arena, float x, float y, float w, float h) {
+    auto model = arena.makeShared<logic::FruitModel>(x, y, w, h);
+    auto view = arena.make<FruitView>(model.get(), window, camera, spriteTexture);
     return {model, std::move(view)};
 }
 } // namespace representation
\ No newline at end of file
@@ -1,18 +1,23 @@
 #include "representation/Game.h"
 #include "logic/utils/Stopwatch.h"
+#include "logic/replay/Replay.h"
+#include "representation/states/LevelState.h"
 #include "representation/states/MenuState.h"
 #include "representation/states/State.h"
+#include <algorithm>
 #include <iostream>
 
 namespace representation {
-Game::Game(sf::RenderWindow* win, const std::string& mapFile) : window(win), mapFile(mapFile) {
+Game::Game(sf::RenderWindow* win, const std::string& mapFile)
+    : window(win), mapFile(mapFile), tickAccumulator(0.0f), tickDuration(logic::Stopwatch::FIXED_TICK) {
 
     const float SIDEBAR_WIDTH = 250.0f; // UI overlay width (score, lives, level)
     camera = std::make_unique<Camera>(static_cast<float>(window->getSize().x),
                                       static_cast<float>(window->getSize().y),
                                       SIDEBAR_WIDTH);
 
-    factory = std::make_unique<ConcreteFactory>(window, camera.get());
+    interpolation = std::make_unique<RenderInterpolation>();
+    factory = std::make_unique<ConcreteFactory>(window, camera.get(), interpolation.get());
     stateManager = std::make_unique<StateManager>();
 
     // Initialize with MenuState (entry point)
@@ -24,15 +29,29 @@ Game::~Game() {
     SoundManager::cleanup();
 }
 
+void Game::setTickRate(int ticksPerSecond) {
+    if (ticksPerSecond > 0) {
+        tickDuration = 1.0f / static_cast<float>(ticksPerSecond);
+    }
+}
+
+void Game::playReplay(const std::string& replayFile) {
+    logic::Replay replay = logic::Replay::load(replayFile);
+    tickDuration = replay.tickDuration;
+
+    stateManager->pushState(
+        std::make_unique<LevelState>(window, factory.get(), camera.get(), stateManager.get(), replay));
+}
+
 void Game::run() {
     try {
         logic::Stopwatch& stopwatch = logic::Stopwatch::getInstance();
         stopwatch.restart();
 
-        // Main game loop: event polling → update → render → display
+        // Main game loop: event polling → fixed-step updates → render → display
         while (window->isOpen()) {
             stopwatch.update();
-            float dt = stopwatch.getDeltaTime();
+            tickAccumulator += std::min(stopwatch.getDeltaTime(), MAX_FRAME_TIME);
 
             sf::Event event;
             while (window->pollEvent(event)) {
@@ -43,8 +62,22 @@ void Game::run() {
                 stateManager->handleEvent(event);
             }
 
+            int ticks = 0;
+            while (tickAccumulator >= tickDuration && ticks < MAX_TICKS_PER_FRAME) {
+                stateManager->update(tickDuration);
+                tickAccumulator -= tickDuration;
+                ticks++;
+            }
+
+            // Still behind after the cap: drop the backlog (game slows down instead of freezing)
+            if (ticks == MAX_TICKS_PER_FRAME) {
+                tickAccumulator = std::min(tickAccumulator, tickDuration);
+            }
+
+            // Views draw moving entities this far between previous and current tick
+            interpolation->setAlpha(tickAccumulator / tickDuration);
+
             window->clear(sf::Color::Black);
-            stateManager->update(dt);
             stateManager->render();
             window->display();
         }
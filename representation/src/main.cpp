@@ -1,11 +1,25 @@
 #include "logic/world/World.h"
 #include "representation/Game.h"
 #include <SFML/Graphics.hpp>
+#include <cstdlib>
 #include <iostream>
+#include <string>
 
-int main() {
+int main(int argc, char* argv[]) {
     const std::string MAP_FILE = "resources/maps/map";
 
+    // Optional: --tick-rate <Hz> (simulation rate, rendering stays at display rate)
+    //           --replay <file> (play back a recorded game, e.g. replays/last.replay)
+    int tickRate = 0;
+    std::string replayFile;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::string(argv[i]) == "--tick-rate") {
+            tickRate = std::atoi(argv[i + 1]);
+        } else if (std::string(argv[i]) == "--replay") {
+            replayFile = argv[i + 1];
+        }
+    }
+
     sf::VideoMode desktop = sf::VideoMode::getDesktopMode();
     float windowScale = 0.8f;
 
@@ -22,9 +36,20 @@ int main() {
     // Non-resizable to prevent Camera coordinate conversion issues
     sf::RenderWindow window(sf::VideoMode(windowWidth, windowHeight), "PacMan Game",
                             sf::Style::Close | sf::Style::Titlebar);
-    window.setFramerateLimit(60); // Cap at 60 FPS (matches typical display refresh rate)
+    window.setVerticalSyncEnabled(true); // Frame rate follows the display (ticks are interpolated at any rate)
 
     representation::Game game(&window, MAP_FILE);
+    if (tickRate > 0) {
+        game.setTickRate(tickRate);
+    }
+    if (!replayFile.empty()) {
+        try {
+            game.playReplay(replayFile);
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+    }
     game.run();
 
     return 0;
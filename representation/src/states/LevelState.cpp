@@ -1,22 +1,36 @@
 #include "representation/states/LevelState.h"
 #include "logic/entities/PacManModel.h"
+#include "logic/utils/Random.h"
 #include "representation/Camera.h"
 #include "representation/SoundManager.h"
 #include "representation/StateManager.h"
 #include "representation/states/NameEntryState.h"
 #include "representation/states/PausedState.h"
 #include "representation/states/VictoryState.h"
+#include <algorithm>
+#include <filesystem>
 
 namespace representation {
 // World owned by unique_ptr, auto-destructs and cascades cleanup to entities
-LevelState::~LevelState() {}
+LevelState::~LevelState() { saveRecording(); }
 
 LevelState::LevelState(sf::RenderWindow* win, logic::AbstractFactory* fac, const Camera* cam, StateManager* sm,
                        const std::string& mapFile)
-    : State(win, fac, cam, sm), mapFile(mapFile), cheatBuffer("") {
+    : LevelState(win, fac, cam, sm, mapFile, nullptr) {}
+
+LevelState::LevelState(sf::RenderWindow* win, logic::AbstractFactory* fac, const Camera* cam, StateManager* sm,
+                       const logic::Replay& replay)
+    : LevelState(win, fac, cam, sm, replay.mapFile, &replay) {}
+
+LevelState::LevelState(sf::RenderWindow* win, logic::AbstractFactory* fac, const Camera* cam, StateManager* sm,
+                       const std::string& mapFile, const logic::Replay* replay)
+    : State(win, fac, cam, sm), mapFile(mapFile), cheatBuffer(""), recordingSaved(false) {
 
     world = std::make_unique<logic::World>();
     world->setFactory(factory);
+    if (replay) {
+        world->setSeed(replay->seed);
+    }
 
     try {
         world->loadMap(mapFile);
@@ -53,13 +67,11 @@ LevelState::LevelState(sf::RenderWindow* win, logic::AbstractFactory* fac, const
         readyText.setPosition(window->getSize().x / 2.0f, window->getSize().y / 2.0f - 7);
     }
 
-    // Convert normalized coordinates [-1,1] to grid cell dimensions
+    // Cell dimensions of the loaded grid (no second read of the map file)
     auto pacman = world->getPacMan();
     if (pacman) {
-        auto [mapWidth, mapHeight] = logic::World::getMapDimensions(mapFile);
-        float cellWidth = 2.0f / mapWidth;   // 2.0f = full normalized width
-        float cellHeight = 2.0f / mapHeight; // 2.0f = full normalized height
-        pacman->setCellDimensions(cellWidth, cellHeight);
+        const logic::TileGrid& grid = world->getTileGrid();
+        pacman->setCellDimensions(grid.getCellWidth(), grid.getCellHeight());
     }
 
     SoundManager::getInstance().stopMenuMusic();
@@ -69,74 +81,93 @@ LevelState::LevelState(sf::RenderWindow* win, logic::AbstractFactory* fac, const
     world->getScoreSubject()->attach(soundObserver.get());
 
     // Initial countdown before gameplay starts
-    isCountingDown = true;
-    countdownTimer = 1.0f; // 1 second "READY!" display
+    session = std::make_unique<logic::LevelSession>(*world);
+    if (replay) {
+        session->startPlayback(*replay);
+    } else {
+        session->startRecording(mapFile);
+    }
 }
 
-void LevelState::update(float deltaTime) {
-    if (isCountingDown) {
-        countdownTimer -= deltaTime;
-
-        if (countdownTimer <= 0.0f) {
-            isCountingDown = false;
-            world->clearRespawnFlag();
-        }
+void LevelState::saveRecording() {
+    const logic::Replay* recording = session ? session->finishRecording() : nullptr;
+    if (!recording || recordingSaved) {
         return;
     }
+    recordingSaved = true;
 
-    SoundManager::getInstance().update(deltaTime);
-
-    // Respawn triggers new countdown (after death)
-    if (world->justRespawned()) {
-        isCountingDown = true;
-        countdownTimer = 1.0f; // 1 second pause after respawn
-        SoundManager::getInstance().stopCoinSound();
-        return;
+    try {
+        std::filesystem::create_directories(std::filesystem::path(REPLAY_FILE).parent_path());
+        recording->save(REPLAY_FILE);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
     }
+}
+
+void LevelState::restart() {
+    saveRecording(); // The finished game stays available as the last replay
+    recordingSaved = false;
+    cheatBuffer.clear();
+    SoundManager::getInstance().stopCoinSound();
 
-    world->update(deltaTime);
+    // New game, new ghost randomness (a replay restarts with its own seed)
+    if (!session->isPlayingBack()) {
+        world->setSeed(logic::Random::randomSeed());
+    }
+    session->restart();
 
     if (fontLoaded) {
         scoreText.setString("SCORE: " + std::to_string(world->getScore()));
     }
+}
 
-    int coinsCollected = world->getCoinsCollected();
-    int totalCoins = world->getTotalCoins();
+void LevelState::update(float deltaTime) {
+    if (!session->isCountingDown()) {
+        SoundManager::getInstance().update(deltaTime);
+    }
+
+    logic::LevelStep step = session->update(deltaTime);
 
-    // Victory: All coins collected → next level
-    if (coinsCollected >= totalCoins) {
-        world->getScoreObject()->setEvent(logic::ScoreEvent::LEVEL_CLEARED);
-        world->getScoreSubject()->notify();
+    switch (step) {
+    case logic::LevelStep::COUNTDOWN:
+        return;
+
+    case logic::LevelStep::RESPAWNED:
+        SoundManager::getInstance().stopCoinSound();
+        return;
 
+    case logic::LevelStep::LEVEL_CLEARED:
         SoundManager::getInstance().stopCoinSound();
+        break;
 
-        world->nextLevel();
+    case logic::LevelStep::PLAYING:
+    case logic::LevelStep::GAME_OVER:
+        break;
+    }
 
-        isCountingDown = true;
-        countdownTimer = 2.0f; // 2 second "READY!" between levels
-        return;
+    if (fontLoaded) {
+        scoreText.setString("SCORE: " + std::to_string(world->getScore()));
     }
 
     // Game Over: Lives depleted → high score entry or victory screen
-    auto pacman = world->getPacMan();
-    if (pacman && pacman->getLives() <= 0) {
+    if (step == logic::LevelStep::GAME_OVER) {
         int finalScore = world->getScore();
+        saveRecording();
 
-        if (logic::Score::isHighScore(finalScore)) {
+        if (logic::Score::isHighScore(finalScore) && !session->isPlayingBack()) {
             stateManager->pushState(
-                std::make_unique<NameEntryState>(window, factory, camera, stateManager, finalScore, mapFile));
+                std::make_unique<NameEntryState>(window, factory, camera, stateManager, finalScore, this));
         } else {
             stateManager->pushState(
-                std::make_unique<VictoryState>(window, factory, camera, stateManager, false, finalScore, mapFile));
+                std::make_unique<VictoryState>(window, factory, camera, stateManager, false, finalScore, this));
         }
-        return;
     }
 }
 
 void LevelState::render() {
     world->renderInOrder();
 
-    if (isCountingDown && fontLoaded) {
+    if (session->isCountingDown() && fontLoaded) {
         window->draw(readyText);
     }
 
@@ -185,18 +216,13 @@ void LevelState::handleEvent(const sf::Event& event) {
 
             // "GHOST" cheat: activate fear mode
             if (cheatBuffer.find("GHOST") != std::string::npos) {
-                world->activateFearMode();
+                session->applyInput(logic::InputAction::FEAR_CHEAT);
                 cheatBuffer.clear();
             }
 
             // "LEVEL" cheat: skip to next level
             if (cheatBuffer.find("LEVEL") != std::string::npos) {
-                world->getScoreObject()->setEvent(logic::ScoreEvent::LEVEL_CLEARED);
-                world->getScoreSubject()->notify();
-
-                world->nextLevel();
-                isCountingDown = true;
-                countdownTimer = 2.0f;
+                session->applyInput(logic::InputAction::LEVEL_CHEAT);
                 cheatBuffer.clear();
             }
         }
@@ -207,8 +233,11 @@ void LevelState::handleEvent(const sf::Event& event) {
         if (event.key.code == sf::Keyboard::P) {
             cheatBuffer.clear();
             SoundManager::getInstance().stopCoinSound();
+
+            // Level is rendered frozen below the pause menu: stop interpolating
+            world->storePreviousPositions();
             stateManager->pushState(
-                std::make_unique<PausedState>(window, factory, camera, stateManager, this, mapFile));
+                std::make_unique<PausedState>(window, factory, camera, stateManager, this));
             return;
         }
 
@@ -219,15 +248,28 @@ void LevelState::handleEvent(const sf::Event& event) {
             return;
         }
 
-        // Arrow key input → buffered direction (applied when valid in World::update)
-        if (event.key.code == sf::Keyboard::Up && pacman->getCurrentDirection() != logic::Direction::UP) {
-            pacman->setNextDirection(logic::Direction::UP);
-        } else if (event.key.code == sf::Keyboard::Down && pacman->getCurrentDirection() != logic::Direction::DOWN) {
-            pacman->setNextDirection(logic::Direction::DOWN);
-        } else if (event.key.code == sf::Keyboard::Left && pacman->getCurrentDirection() != logic::Direction::LEFT) {
-            pacman->setNextDirection(logic::Direction::LEFT);
-        } else if (event.key.code == sf::Keyboard::Right && pacman->getCurrentDirection() != logic::Direction::RIGHT) {
-            pacman->setNextDirection(logic::Direction::RIGHT);
+        // Playback: Left/Right scrub through the replay (keyframe seek)
+        if (const logic::Replay* replay = session->getPlayback()) {
+            const auto SEEK_TICKS = static_cast<long>(SEEK_SECONDS / replay->tickDuration);
+            long tick = static_cast<long>(session->getTick());
+
+            if (event.key.code == sf::Keyboard::Left || event.key.code == sf::Keyboard::Right) {
+                long target = event.key.code == sf::Keyboard::Left ? tick - SEEK_TICKS : tick + SEEK_TICKS;
+                session->seek(static_cast<uint32_t>(std::max(0L, target)));
+                SoundManager::getInstance().stopCoinSound();
+            }
+            return;
+        }
+
+        // Arrow key input → buffered direction (applied when valid in World::update), recorded per tick
+        if (event.key.code == sf::Keyboard::Up) {
+            session->applyInput(logic::InputAction::UP);
+        } else if (event.key.code == sf::Keyboard::Down) {
+            session->applyInput(logic::InputAction::DOWN);
+        } else if (event.key.code == sf::Keyboard::Left) {
+            session->applyInput(logic::InputAction::LEFT);
+        } else if (event.key.code == sf::Keyboard::Right) {
+            session->applyInput(logic::InputAction::RIGHT);
         }
     }
 }
@@ -5,8 +5,8 @@
 
 namespace representation {
 NameEntryState::NameEntryState(sf::RenderWindow* win, logic::AbstractFactory* fac, const Camera* cam, StateManager* sm,
-                               int finalScore, const std::string& mapFile)
-    : State(win, fac, cam, sm), finalScore(finalScore), mapFile(mapFile), playerName("   "), currentLetterIndex(0),
+                               int finalScore, LevelState* levelState)
+    : State(win, fac, cam, sm), finalScore(finalScore), levelState(levelState), playerName("   "), currentLetterIndex(0),
       fontLoaded(false), blinkTimer(0.0f), cursorVisible(true), isNewHighScore(logic::Score::isTopScore(finalScore)) {
 
     if (font.loadFromFile("resources/fonts/joystix.otf") || font.loadFromFile("C:/Windows/Fonts/arial.ttf")) {
@@ -89,12 +89,12 @@ void NameEntryState::saveAndContinue() {
     logic::AbstractFactory* fac = factory;
     const Camera* cam = camera;
     int score = finalScore;
-    std::string map = mapFile;
+    LevelState* level = levelState;
 
     sm->popState(); // Pop NameEntryState - 'this' is now DESTROYED
     // DO NOT ACCESS ANY MEMBER VARIABLES AFTER THIS LINE
 
-    sm->pushState(std::make_unique<VictoryState>(win, fac, cam, sm, true, score, map));
+    sm->pushState(std::make_unique<VictoryState>(win, fac, cam, sm, true, score, level));
 }
 
 void NameEntryState::update(float deltaTime) {
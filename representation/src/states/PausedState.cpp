@@ -5,8 +5,8 @@
 
 namespace representation {
 PausedState::PausedState(sf::RenderWindow* win, logic::AbstractFactory* fac, const Camera* cam, StateManager* sm,
-                         State* levelState, const std::string& mapFile)
-    : State(win, fac, cam, sm), fontLoaded(false), levelStateBelow(levelState), mapFile(mapFile) {
+                         LevelState* levelState)
+    : State(win, fac, cam, sm), fontLoaded(false), levelStateBelow(levelState) {
 
     if (font.loadFromFile("resources/fonts/joystix.otf") || font.loadFromFile("C:/Windows/Fonts/arial.ttf")) {
         fontLoaded = true;
@@ -89,17 +89,12 @@ void PausedState::handleEvent(const sf::Event& event) {
 
         if (event.key.code == sf::Keyboard::R) {
             // CRITICAL: Copy all needed data BEFORE popping
-            StateManager* sm = stateManager;
-            sf::RenderWindow* win = window;
-            logic::AbstractFactory* fac = factory;
-            const Camera* cam = camera;
-            std::string map = mapFile;
-
-            sm->popState(); // Pop PausedState - 'this' is now DESTROYED
-            sm->popState(); // Pop old LevelState
+            LevelState* level = levelStateBelow;
+
+            stateManager->popState(); // Pop PausedState - 'this' is now DESTROYED
             // DO NOT ACCESS ANY MEMBER VARIABLES AFTER THIS LINE
 
-            sm->pushState(std::make_unique<LevelState>(win, fac, cam, sm, map));
+            level->restart(); // Warm restart: same World, entities and views
         }
     }
 }
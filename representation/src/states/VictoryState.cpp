@@ -6,8 +6,8 @@
 
 namespace representation {
 VictoryState::VictoryState(sf::RenderWindow* win, logic::AbstractFactory* fac, const Camera* cam, StateManager* sm,
-                           bool won, int finalScore, const std::string& mapFile)
-    : State(win, fac, cam, sm), won(won), finalScore(finalScore), mapFile(mapFile), fontLoaded(false),
+                           bool won, int finalScore, LevelState* levelState)
+    : State(win, fac, cam, sm), won(won), finalScore(finalScore), levelState(levelState), fontLoaded(false),
       isHighScore(logic::Score::isTopScore(finalScore)), blinkTimer(0.0f), newHighScoreVisible(true) {
 
     if (font.loadFromFile("resources/fonts/joystix.otf") || font.loadFromFile("C:/Windows/Fonts/arial.ttf")) {
@@ -108,17 +108,12 @@ void VictoryState::handleEvent(const sf::Event& event) {
 
     if (event.key.code == sf::Keyboard::R) {
         // CRITICAL: Copy all needed data BEFORE popping
-        StateManager* sm = stateManager;
-        sf::RenderWindow* win = window;
-        logic::AbstractFactory* fac = factory;
-        const Camera* cam = camera;
-        std::string map = mapFile;
-
-        sm->popState(); // Pop VictoryState - 'this' is now DESTROYED
-        sm->popState(); // Pop LevelState
+        LevelState* level = levelState;
+
+        stateManager->popState(); // Pop VictoryState - 'this' is now DESTROYED
         // DO NOT ACCESS ANY MEMBER VARIABLES AFTER THIS LINE
 
-        sm->pushState(std::make_unique<LevelState>(win, fac, cam, sm, map));
+        level->restart(); // Warm restart: same World, entities and views
         return;
     }
 
@@ -2,11 +2,10 @@
 #include <iostream>
 
 namespace representation {
-CoinView::CoinView(logic::CoinModel* model, sf::RenderWindow* window, const Camera* camera,
-                   std::shared_ptr<sf::Texture> sharedTexture)
-    : EntityView(model, window, camera), coinModel(model), texture(sharedTexture) {
+CoinView::CoinView(logic::CoinModel* model, sf::RenderWindow* window, const Camera* camera, const sf::Texture& texture)
+    : EntityView(model, window, camera), coinModel(model) {
 
-    sprite.setTexture(*texture);
+    sprite.setTexture(texture);
     sprite.setTextureRect(sf::IntRect(410, 208, 6, 6)); // Small coin dot from sprite sheet
     sprite.setOrigin(3.0f, 3.0f);                        // Center origin (half of 6x6)
 }
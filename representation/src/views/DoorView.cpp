@@ -1,11 +1,10 @@
 #include "representation/views/DoorView.h"
 
 namespace representation {
-DoorView::DoorView(logic::DoorModel* model, sf::RenderWindow* window, const Camera* camera,
-                   std::shared_ptr<sf::Texture> sharedTexture)
-    : EntityView(model, window, camera), doorModel(model), texture(sharedTexture) {
+DoorView::DoorView(logic::DoorModel* model, sf::RenderWindow* window, const Camera* camera, const sf::Texture& texture)
+    : EntityView(model, window, camera), doorModel(model) {
 
-    sprite.setTexture(*texture);
+    sprite.setTexture(texture);
     sprite.setTextureRect(sf::IntRect(636, 520, 15, 5)); // Horizontal door bar from sprite sheet
     sprite.setOrigin(7.0f, 7.0f);
 }
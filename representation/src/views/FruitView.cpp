@@ -2,10 +2,10 @@
 
 namespace representation {
 FruitView::FruitView(logic::FruitModel* model, sf::RenderWindow* window, const Camera* camera,
-                     std::shared_ptr<sf::Texture> sharedTexture)
-    : EntityView(model, window, camera), fruitModel(model), texture(sharedTexture) {
+                     const sf::Texture& texture)
+    : EntityView(model, window, camera), fruitModel(model) {
 
-    sprite.setTexture(*texture);
+    sprite.setTexture(texture);
     // Cherry sprite (example coords - we'll verify later)
     sprite.setTextureRect(sf::IntRect(550, 300, 50, 50));
     sprite.setOrigin(18.5f, 24.5f);
@@ -2,11 +2,11 @@
 
 namespace representation {
 GhostView::GhostView(logic::GhostModel* model, sf::RenderWindow* window, const Camera* camera,
-                     std::shared_ptr<sf::Texture> sharedTexture)
-    : EntityView(model, window, camera), ghostModel(model), texture(sharedTexture), showDebugVisualization(false),
-      animationTimer(0.0f), frameIndex(0) {
+                     const RenderInterpolation* interpolation, const sf::Texture& texture)
+    : EntityView(model, window, camera), ghostModel(model), interpolation(interpolation),
+      showDebugVisualization(false), animationTimer(0.0f), frameIndex(0) {
 
-    sprite.setTexture(*texture);
+    sprite.setTexture(texture);
     sprite.setTextureRect(sf::IntRect(0, 0, 50, 50));
 }
 
@@ -16,8 +16,10 @@ void GhostView::draw() {
     logic::GhostState state = ghostModel->getState();
 
     // 2-frame animation: switch every 0.15s when moving
+    // Wall-clock driven so the cycle speed doesn't depend on how often the view is drawn
+    float deltaTime = animationClock.restart().asSeconds();
     if (direction != logic::Direction::NONE) {
-        animationTimer += 0.016f; // Approximate frame time at 60 FPS
+        animationTimer += deltaTime;
 
         if (animationTimer >= 0.15f) {
             frameIndex = (frameIndex == 0) ? 1 : 0;
@@ -110,8 +112,8 @@ void GhostView::draw() {
 
     sprite.setTextureRect(sf::IntRect(spriteX, spriteY, 50, 50));
 
-    float centerX = ghostModel->getX();
-    float centerY = ghostModel->getY();
+    float centerX = ghostModel->getInterpolatedX(interpolation->getAlpha());
+    float centerY = ghostModel->getInterpolatedY(interpolation->getAlpha());
 
     float pixelCenterX = camera->normalizedToPixelX(centerX);
     float pixelCenterY = camera->normalizedToPixelY(centerY);
@@ -3,11 +3,11 @@
 
 namespace representation {
 PacManView::PacManView(logic::PacManModel* model, sf::RenderWindow* window, const Camera* camera,
-                       std::shared_ptr<sf::Texture> sharedTexture)
-    : EntityView(model, window, camera), pacManModel(model), texture(sharedTexture), animationTimer(0.0f),
-      frameIndex(0) {
+                       const RenderInterpolation* interpolation, const sf::Texture& texture)
+    : EntityView(model, window, camera), pacManModel(model), interpolation(interpolation),
+      animationTimer(0.0f), frameIndex(0) {
 
-    sprite.setTexture(*texture);
+    sprite.setTexture(texture);
     sprite.setTextureRect(sf::IntRect(840, 0, 50, 50)); // Full circle (mouth closed)
 }
 
@@ -25,8 +25,8 @@ void PacManView::draw() {
         sprite.setOrigin(29.5f, 22.0f);
         sprite.setScale(1.15f, 1.15f);
 
-        float centerX = pacManModel->getX();
-        float centerY = pacManModel->getY();
+        float centerX = pacManModel->getInterpolatedX(interpolation->getAlpha());
+        float centerY = pacManModel->getInterpolatedY(interpolation->getAlpha());
         float pixelCenterX = camera->normalizedToPixelX(centerX);
         float pixelCenterY = camera->normalizedToPixelY(centerY);
 
@@ -94,8 +94,8 @@ void PacManView::draw() {
         animationClock.restart();
     }
 
-    float centerX = pacManModel->getX();
-    float centerY = pacManModel->getY();
+    float centerX = pacManModel->getInterpolatedX(interpolation->getAlpha());
+    float centerY = pacManModel->getInterpolatedY(interpolation->getAlpha());
 
     float pixelCenterX = camera->normalizedToPixelX(centerX);
     float pixelCenterY = camera->normalizedToPixelY(centerY);
@@ -139,8 +139,8 @@ void PacManView::renderDeathAnimation() {
 
     sprite.setTextureRect(sf::IntRect(deathSpriteX, deathSpriteY, 50, 50));
 
-    float centerX = pacManModel->getX();
-    float centerY = pacManModel->getY();
+    float centerX = pacManModel->getInterpolatedX(interpolation->getAlpha());
+    float centerY = pacManModel->getInterpolatedY(interpolation->getAlpha());
 
     float pixelCenterX = camera->normalizedToPixelX(centerX);
     float pixelCenterY = camera->normalizedToPixelY(centerY);
@@ -0,0 +1,83 @@
+#ifndef PACMANGAME_BATCHRUNNER_H
+#define PACMANGAME_BATCHRUNNER_H
+
+#include "simulation/Simulation.h"
+#include <string>
+#include <vector>
+
+namespace simulation {
+/**
+ * Parameters of a batch: many independent games derived from one base config.
+ *
+ * Game i uses seed firstSeed + i and input inputs[i % inputs.size()]
+ * (base.input when inputs is empty).
+ */
+struct BatchConfig {
+    SimulationConfig base;
+    long games = 1;
+    uint64_t firstSeed = 1;
+    unsigned int threads = 0; // 0 = std::thread::hardware_concurrency()
+    std::vector<std::string> inputs;
+};
+
+/**
+ * Min / mean / max of one outcome over all games of a batch.
+ */
+struct Statistic {
+    double min = 0.0;
+    double mean = 0.0;
+    double max = 0.0;
+};
+
+/**
+ * Aggregated outcome of a batch.
+ */
+struct BatchSummary {
+    long games = 0;
+    long gameOvers = 0;
+    long totalFrames = 0;
+    unsigned int threads = 0;
+    double elapsedSeconds = 0.0; // Wall clock of the whole batch
+
+    Statistic score;
+    Statistic level;
+    Statistic deaths;
+    Statistic frames; // Frames survived
+
+    double gamesPerHour() const { return elapsedSeconds > 0.0 ? games * 3600.0 / elapsedSeconds : 0.0; }
+
+    double framesPerSecond() const { return elapsedSeconds > 0.0 ? totalFrames / elapsedSeconds : 0.0; }
+};
+
+/**
+ * Runs many independent Simulations concurrently on a fixed pool of worker threads.
+ *
+ * Every game owns its World, seed and InputSource (no shared mutable state), so
+ * throughput scales with cores. Workers pull game indices from an atomic counter;
+ * results are stored per game index, making the output independent of scheduling.
+ */
+class BatchRunner {
+private:
+    BatchConfig config;
+    std::vector<SimulationResult> results;
+
+    SimulationConfig configForGame(long index) const;
+
+public:
+    explicit BatchRunner(const BatchConfig& config);
+
+    /**
+     * Runs all games and aggregates their outcomes.
+     *
+     * @throws std::runtime_error first error raised by any game (map/script loading)
+     */
+    BatchSummary run();
+
+    /**
+     * Per-game results of the last run, indexed by game number.
+     */
+    const std::vector<SimulationResult>& getResults() const { return results; }
+};
+} // namespace simulation
+
+#endif // PACMANGAME_BATCHRUNNER_H
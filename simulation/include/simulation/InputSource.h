@@ -0,0 +1,84 @@
+#ifndef PACMANGAME_INPUTSOURCE_H
+#define PACMANGAME_INPUTSOURCE_H
+
+#include "logic/world/LevelSession.h"
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace simulation {
+/**
+ * Player input provider for headless runs (replaces keyboard events).
+ *
+ * Called once per simulated frame before the World steps, feeds directions
+ * through LevelSession::applyInput the same way LevelState does for arrow keys.
+ */
+class InputSource {
+public:
+    virtual ~InputSource() = default;
+
+    virtual void apply(long frame, logic::LevelSession& session) = 0;
+
+    /**
+     * Creates input source from command line spec.
+     *
+     * Specs: "idle", "random" (seeded), "script:<file>".
+     *
+     * @throws std::runtime_error on unknown spec or unreadable script
+     */
+    static std::unique_ptr<InputSource> create(const std::string& spec, uint64_t seed);
+
+protected:
+    /**
+     * Arrow key press (ignored by the session when PacMan already moves that way).
+     */
+    static void press(logic::LevelSession& session, logic::Direction direction);
+};
+
+/**
+ * No input: PacMan stays at spawn, ghosts play alone.
+ */
+class IdleInput : public InputSource {
+public:
+    void apply(long, logic::LevelSession&) override {}
+};
+
+/**
+ * Random direction presses at random intervals (independent of game RNG).
+ */
+class RandomInput : public InputSource {
+private:
+    std::mt19937 generator;
+
+public:
+    explicit RandomInput(uint64_t seed);
+
+    void apply(long frame, logic::LevelSession& session) override;
+};
+
+/**
+ * Scripted presses read from file.
+ *
+ * One "<frame> <U|D|L|R>" entry per line, sorted by frame. Empty lines and
+ * lines starting with '#' are ignored.
+ */
+class ScriptInput : public InputSource {
+private:
+    struct Press {
+        long frame;
+        logic::Direction direction;
+    };
+
+    std::vector<Press> presses;
+    size_t next;
+
+public:
+    explicit ScriptInput(const std::string& filename);
+
+    void apply(long frame, logic::LevelSession& session) override;
+};
+} // namespace simulation
+
+#endif // PACMANGAME_INPUTSOURCE_H
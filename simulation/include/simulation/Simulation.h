@@ -0,0 +1,68 @@
+#ifndef PACMANGAME_SIMULATION_H
+#define PACMANGAME_SIMULATION_H
+
+#include "logic/replay/Replay.h"
+#include "logic/utils/Stopwatch.h"
+#include <cstdint>
+#include <string>
+
+namespace simulation {
+/**
+ * Parameters of one headless run (filled from the command line).
+ */
+struct SimulationConfig {
+    std::string mapFile = "resources/maps/map";
+    uint64_t seed = 1;                              // World seed (ghost AI) and random input
+    long maxFrames = 36000;                         // 5 minutes of game time
+    float deltaTime = logic::Stopwatch::FIXED_TICK; // Same fixed step as the game
+    std::string input = "random";
+    std::string recordFile;                         // Save the run as a replay (empty = don't record)
+    const logic::Replay* replay = nullptr;          // Play back instead of input, seeds the World with its seed
+    long seekFrame = 0;                             // Replay only: jump here first (keyframe + re-simulation)
+};
+
+/**
+ * Outcome and throughput of one headless run.
+ */
+struct SimulationResult {
+    long frames = 0;
+    bool gameOver = false;
+    int score = 0;
+    int level = 0;
+    int lives = 0;
+    int deaths = 0;
+    int coinsCollected = 0;
+    uint64_t checksum = 0;       // World::checksum after the last frame
+    bool replayDiverged = false; // Playback ended in a different state than recorded
+    double elapsedSeconds = 0.0; // Wall clock, simulation loop only (map loading excluded)
+    double seekSeconds = 0.0;    // Wall clock of the initial replay seek
+
+    double framesPerSecond() const { return elapsedSeconds > 0.0 ? frames / elapsedSeconds : 0.0; }
+
+    double microsecondsPerFrame() const { return frames > 0 ? elapsedSeconds * 1e6 / frames : 0.0; }
+};
+
+/**
+ * Headless game runner: World + LevelSession driven by an InputSource, no window, views or sound.
+ *
+ * Steps the level with a fixed deltaTime until maxFrames or game over.
+ * Countdown frames count as frames (same timeline as the windowed game).
+ * With a replay the run reproduces the recorded game and compares final checksums.
+ * Each run owns all of its state (World, RNG streams, input), so separate
+ * Simulations can run concurrently on different threads (see BatchRunner).
+ */
+class Simulation {
+private:
+    SimulationConfig config;
+
+public:
+    explicit Simulation(const SimulationConfig& config);
+
+    /**
+     * @throws std::runtime_error if map or input script cannot be loaded
+     */
+    SimulationResult run();
+};
+} // namespace simulation
+
+#endif // PACMANGAME_SIMULATION_H
@@ -0,0 +1,110 @@
+#include "simulation/BatchRunner.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace simulation {
+namespace {
+/**
+ * Running min/max/sum, finalized into a Statistic.
+ */
+struct Accumulator {
+    double min = 0.0;
+    double max = 0.0;
+    double sum = 0.0;
+    long count = 0;
+
+    void add(double value) {
+        min = count == 0 ? value : std::min(min, value);
+        max = count == 0 ? value : std::max(max, value);
+        sum += value;
+        count++;
+    }
+
+    Statistic finish() const { return {min, count > 0 ? sum / count : 0.0, max}; }
+};
+} // namespace
+
+BatchRunner::BatchRunner(const BatchConfig& config) : config(config) {}
+
+SimulationConfig BatchRunner::configForGame(long index) const {
+    SimulationConfig game = config.base;
+    game.seed = config.firstSeed + static_cast<uint64_t>(index);
+    if (!config.inputs.empty()) {
+        game.input = config.inputs[static_cast<size_t>(index) % config.inputs.size()];
+    }
+    return game;
+}
+
+BatchSummary BatchRunner::run() {
+    results.assign(static_cast<size_t>(std::max(0L, config.games)), SimulationResult());
+
+    unsigned int threadCount = config.threads > 0 ? config.threads : std::thread::hardware_concurrency();
+    threadCount = std::max(1u, threadCount);
+
+    std::atomic<long> nextGame{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr firstError;
+    std::mutex errorMutex;
+
+    auto worker = [&]() {
+        while (!failed.load(std::memory_order_relaxed)) {
+            long index = nextGame.fetch_add(1, std::memory_order_relaxed);
+            if (index >= config.games) {
+                return;
+            }
+
+            try {
+                results[static_cast<size_t>(index)] = Simulation(configForGame(index)).run();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!firstError) {
+                    firstError = std::current_exception();
+                }
+                failed = true;
+            }
+        }
+    };
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    for (unsigned int i = 0; i < threadCount; i++) {
+        workers.emplace_back(worker);
+    }
+    for (auto& thread : workers) {
+        thread.join();
+    }
+
+    auto end = std::chrono::steady_clock::now();
+
+    if (firstError) {
+        std::rethrow_exception(firstError);
+    }
+
+    BatchSummary summary;
+    summary.games = static_cast<long>(results.size());
+    summary.threads = threadCount;
+    summary.elapsedSeconds = std::chrono::duration<double>(end - start).count();
+
+    Accumulator score, level, deaths, frames;
+    for (const auto& result : results) {
+        summary.gameOvers += result.gameOver ? 1 : 0;
+        summary.totalFrames += result.frames;
+
+        score.add(result.score);
+        level.add(result.level);
+        deaths.add(result.deaths);
+        frames.add(static_cast<double>(result.frames));
+    }
+
+    summary.score = score.finish();
+    summary.level = level.finish();
+    summary.deaths = deaths.finish();
+    summary.frames = frames.finish();
+    return summary;
+}
+} // namespace simulation
@@ -0,0 +1,89 @@
+#include "simulation/InputSource.h"
+#include "logic/utils/Stopwatch.h"
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace simulation {
+std::unique_ptr<InputSource> InputSource::create(const std::string& spec, uint64_t seed) {
+    const std::string SCRIPT_PREFIX = "script:";
+
+    if (spec == "idle") {
+        return std::make_unique<IdleInput>();
+    }
+    if (spec == "random") {
+        return std::make_unique<RandomInput>(seed);
+    }
+    if (spec.compare(0, SCRIPT_PREFIX.size(), SCRIPT_PREFIX) == 0) {
+        return std::make_unique<ScriptInput>(spec.substr(SCRIPT_PREFIX.size()));
+    }
+    throw std::runtime_error("ERROR: Unknown input source: " + spec);
+}
+
+void InputSource::press(logic::LevelSession& session, logic::Direction direction) {
+    session.applyInput(logic::inputActionFor(direction));
+}
+
+// High seed bits folded into the 32-bit engine seed (seeds below 2^32 seed it unchanged)
+RandomInput::RandomInput(uint64_t seed) : generator(static_cast<uint32_t>(seed ^ (seed >> 32))) {}
+
+void RandomInput::apply(long, logic::LevelSession& session) {
+    // ~2 presses per second at the game tick rate
+    std::uniform_int_distribution<int> pressRoll(0, logic::Stopwatch::TICK_RATE / 2 - 1);
+    if (pressRoll(generator) != 0) {
+        return;
+    }
+
+    std::uniform_int_distribution<int> directionRoll(0, 3);
+    press(session, logic::MOVE_DIRECTIONS[directionRoll(generator)]);
+}
+
+ScriptInput::ScriptInput(const std::string& filename) : next(0) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("ERROR: Cannot open input script: " + filename);
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream entry(line);
+        long frame;
+        char key;
+        if (!(entry >> frame >> key)) {
+            throw std::runtime_error("ERROR: Malformed input script line: " + line);
+        }
+
+        // U/D/L/R = arrow keys
+        logic::Direction direction;
+        switch (key) {
+        case 'U':
+            direction = logic::Direction::UP;
+            break;
+        case 'D':
+            direction = logic::Direction::DOWN;
+            break;
+        case 'L':
+            direction = logic::Direction::LEFT;
+            break;
+        case 'R':
+            direction = logic::Direction::RIGHT;
+            break;
+        default:
+            throw std::runtime_error("ERROR: Unknown direction in input script: " + line);
+        }
+
+        presses.push_back({frame, direction});
+    }
+}
+
+void ScriptInput::apply(long frame, logic::LevelSession& session) {
+    while (next < presses.size() && presses[next].frame <= frame) {
+        press(session, presses[next].direction);
+        next++;
+    }
+}
+} // namespace simulation
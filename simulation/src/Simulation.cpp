@@ -0,0 +1,72 @@
+#include "simulation/Simulation.h"
+#include "logic/patterns/NullFactory.h"
+#include "logic/world/LevelSession.h"
+#include "logic/world/World.h"
+#include "simulation/InputSource.h"
+#include <chrono>
+
+namespace simulation {
+Simulation::Simulation(const SimulationConfig& config) : config(config) {}
+
+SimulationResult Simulation::run() {
+    logic::NullFactory factory;
+    logic::World world;
+    world.setSeed(config.replay ? config.replay->seed : config.seed);
+    world.setFactory(&factory);
+    world.loadMap(config.mapFile);
+
+    // Score reacts to World events through the subject (LevelState attaches it the same way)
+    world.getScoreSubject()->attach(world.getScoreObject());
+
+    logic::LevelSession session(world);
+    std::unique_ptr<InputSource> input = InputSource::create(config.replay ? "idle" : config.input, config.seed);
+    auto pacman = world.getPacMan();
+
+    SimulationResult result;
+
+    if (config.replay) {
+        session.startPlayback(*config.replay);
+
+        if (config.seekFrame > 0) {
+            auto seekStart = std::chrono::steady_clock::now();
+            session.seek(static_cast<uint32_t>(config.seekFrame));
+            result.seekSeconds =
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - seekStart).count();
+            result.frames = session.getTick();
+        }
+    } else if (!config.recordFile.empty()) {
+        session.startRecording(config.mapFile);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    while (result.frames < config.maxFrames) {
+        input->apply(result.frames, session);
+
+        logic::LevelStep step = session.update(config.deltaTime);
+        result.frames++;
+
+        if (step == logic::LevelStep::GAME_OVER) {
+            result.gameOver = true;
+            break;
+        }
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    result.elapsedSeconds = std::chrono::duration<double>(end - start).count();
+
+    result.score = world.getScore();
+    result.level = world.getCurrentLevel();
+    result.lives = pacman ? pacman->getLives() : 0;
+    result.deaths = world.getDeaths();
+    result.coinsCollected = world.getCoinsCollected();
+    result.checksum = world.checksum();
+
+    if (config.replay) {
+        result.replayDiverged = result.checksum != config.replay->finalChecksum;
+    } else if (const logic::Replay* recording = session.finishRecording()) {
+        recording->save(config.recordFile);
+    }
+    return result;
+}
+} // namespace simulation
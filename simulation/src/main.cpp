@@ -0,0 +1,216 @@
+#include "logic/world/MapData.h"
+#include "simulation/BatchRunner.h"
+#include "simulation/Simulation.h"
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+void printUsage() {
+    std::cout << "Usage: PacManSim [options]\n"
+                 "  --map <file>         Map file (default: resources/maps/map)\n"
+                 "  --seed <n>           RNG seed for ghost AI and random input (default: 1)\n"
+                 "  --frames <n>         Maximum simulated frames (default: 36000)\n"
+                 "  --dt <seconds>       Fixed time step (default: 1/120, the game tick)\n"
+                 "  --input <source>     idle | random | script:<file> (default: random)\n"
+                 "  --record <file>      Save the game as a replay\n"
+                 "  --replay <file>      Play back a replay (map, seed, dt and length from the file),\n"
+                 "                       exits with 1 if the final state differs from the recording\n"
+                 "  --seek <frame>       With --replay: jump to frame via keyframes, then play to the end\n"
+                 "  --compile-map <file> Compile --map to the binary map format (memory mapped, no parsing),\n"
+                 "                       then exit\n"
+                 "Batch mode (many independent games in parallel):\n"
+                 "  --games <n>          Number of games, game i uses seed <seed> + i\n"
+                 "  --threads <n>        Worker threads (default: all cores)\n"
+                 "  --input-list <file>  One input source per line, game i uses line i % count\n"
+                 "  --results <file>     Write per-game results as CSV\n";
+}
+
+std::vector<std::string> readInputList(const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("cannot open input list " + filename);
+    }
+
+    std::vector<std::string> inputs;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line[0] != '#') {
+            inputs.push_back(line);
+        }
+    }
+    return inputs;
+}
+
+void printGame(const simulation::SimulationConfig& config, const simulation::SimulationResult& result) {
+    std::printf("map:         %s\n", config.mapFile.c_str());
+    if (config.replay) {
+        std::printf("seed:        %llu\n", static_cast<unsigned long long>(config.replay->seed));
+        std::printf("input:       replay (%zu inputs)\n", config.replay->inputs.size());
+    } else {
+        std::printf("seed:        %llu\n", static_cast<unsigned long long>(config.seed));
+        std::printf("input:       %s\n", config.input.c_str());
+    }
+    std::printf("frames:      %ld%s\n", result.frames, result.gameOver ? " (game over)" : "");
+    std::printf("score:       %d\n", result.score);
+    std::printf("level:       %d\n", result.level);
+    std::printf("lives:       %d\n", result.lives);
+    std::printf("deaths:      %d\n", result.deaths);
+    std::printf("coins:       %d\n", result.coinsCollected);
+    std::printf("checksum:    %016llx\n", static_cast<unsigned long long>(result.checksum));
+    if (config.replay && config.seekFrame > 0) {
+        std::printf("seek:        frame %ld in %.3f ms\n", config.seekFrame, result.seekSeconds * 1e3);
+    }
+    std::printf("elapsed:     %.3f s\n", result.elapsedSeconds);
+    std::printf("throughput:  %.0f frames/s (%.3f us/frame)\n", result.framesPerSecond(),
+                result.microsecondsPerFrame());
+}
+
+void printStatistic(const char* label, const simulation::Statistic& statistic) {
+    std::printf("%-12s min %.0f  mean %.2f  max %.0f\n", label, statistic.min, statistic.mean, statistic.max);
+}
+
+void printBatch(const simulation::BatchConfig& config, const simulation::BatchSummary& summary) {
+    std::printf("map:         %s\n", config.base.mapFile.c_str());
+    std::printf("games:       %ld (seeds %llu..%llu), %ld game over\n", summary.games,
+                static_cast<unsigned long long>(config.firstSeed),
+                static_cast<unsigned long long>(config.firstSeed + static_cast<uint64_t>(summary.games) - 1),
+                summary.gameOvers);
+    std::printf("threads:     %u\n", summary.threads);
+    printStatistic("score:", summary.score);
+    printStatistic("level:", summary.level);
+    printStatistic("deaths:", summary.deaths);
+    printStatistic("frames:", summary.frames);
+    std::printf("elapsed:     %.3f s\n", summary.elapsedSeconds);
+    std::printf("throughput:  %.0f games/h, %.0f frames/s\n", summary.gamesPerHour(), summary.framesPerSecond());
+}
+
+void writeResults(const std::string& filename, const simulation::BatchConfig& config,
+                  const std::vector<simulation::SimulationResult>& results) {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("ERROR: Cannot write results to " + filename);
+    }
+
+    file << "game,seed,frames,game_over,score,level,lives,deaths,coins\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto& r = results[i];
+        file << i << "," << config.firstSeed + i << "," << r.frames << "," << (r.gameOver ? 1 : 0) << "," << r.score
+             << "," << r.level << "," << r.lives << "," << r.deaths << "," << r.coinsCollected << "\n";
+    }
+}
+} // namespace
+
+int main(int argc, char* argv[]) {
+    simulation::BatchConfig batch;
+    std::string resultsFile;
+    std::string replayFile;
+    std::string compiledMapFile;
+    logic::Replay replay;
+    bool batchMode = false;
+
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+
+            if (arg == "--help" || arg == "-h") {
+                printUsage();
+                return 0;
+            }
+
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("missing value for " + arg);
+            }
+            std::string value = argv[++i];
+
+            if (arg == "--map") {
+                batch.base.mapFile = value;
+            } else if (arg == "--seed") {
+                batch.base.seed = std::stoull(value);
+            } else if (arg == "--frames") {
+                batch.base.maxFrames = std::stol(value);
+            } else if (arg == "--dt") {
+                batch.base.deltaTime = std::stof(value);
+            } else if (arg == "--input") {
+                batch.base.input = value;
+            } else if (arg == "--record") {
+                batch.base.recordFile = value;
+            } else if (arg == "--replay") {
+                replayFile = value;
+            } else if (arg == "--seek") {
+                batch.base.seekFrame = std::stol(value);
+            } else if (arg == "--compile-map") {
+                compiledMapFile = value;
+            } else if (arg == "--games") {
+                batch.games = std::stol(value);
+                batchMode = true;
+            } else if (arg == "--threads") {
+                batch.threads = static_cast<unsigned int>(std::stoul(value));
+                batchMode = true;
+            } else if (arg == "--input-list") {
+                batch.inputs = readInputList(value);
+                batchMode = true;
+            } else if (arg == "--results") {
+                resultsFile = value;
+                batchMode = true;
+            } else {
+                throw std::invalid_argument("unknown option " + arg);
+            }
+        }
+
+        if (!replayFile.empty() && (batchMode || !batch.base.recordFile.empty())) {
+            throw std::invalid_argument("--replay cannot be combined with batch mode or --record");
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "ERROR: Invalid arguments (" << e.what() << ")" << std::endl;
+        printUsage();
+        return 2;
+    }
+
+    try {
+        if (!compiledMapFile.empty()) {
+            logic::MapData::compile(batch.base.mapFile, compiledMapFile);
+            auto [width, height] = logic::MapData::readDimensions(compiledMapFile);
+            std::printf("compiled:    %s -> %s (%dx%d)\n", batch.base.mapFile.c_str(), compiledMapFile.c_str(), width,
+                        height);
+            return 0;
+        }
+
+        if (!replayFile.empty()) {
+            replay = logic::Replay::load(replayFile);
+            batch.base.mapFile = replay.mapFile;
+            batch.base.deltaTime = replay.tickDuration;
+            batch.base.maxFrames = replay.tickCount;
+            batch.base.replay = &replay;
+        }
+
+        if (!batchMode) {
+            simulation::SimulationResult result = simulation::Simulation(batch.base).run();
+            printGame(batch.base, result);
+
+            if (result.replayDiverged) {
+                std::fprintf(stderr, "ERROR: Replay diverged (expected checksum %016llx)\n",
+                             static_cast<unsigned long long>(replay.finalChecksum));
+                return 1;
+            }
+            return 0;
+        }
+
+        batch.firstSeed = batch.base.seed;
+        simulation::BatchRunner runner(batch);
+        simulation::BatchSummary summary = runner.run();
+
+        printBatch(batch, summary);
+        if (!resultsFile.empty()) {
+            writeResults(resultsFile, batch, runner.getResults());
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}